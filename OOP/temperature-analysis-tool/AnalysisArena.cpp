@@ -0,0 +1,44 @@
+#include "AnalysisArena.h"
+
+//self written code start
+AnalysisArena::AnalysisArena(size_t initialBlockBytes)
+    : arena_(initialBlockBytes, &upstream_), allocationCount_(0), bytesRequested_(0) {
+}
+
+void AnalysisArena::release() {
+    arena_.release();
+    upstream_.blockCount = 0;
+    upstream_.blockBytes = 0;
+    allocationCount_ = 0;
+    bytesRequested_ = 0;
+}
+
+void* AnalysisArena::do_allocate(size_t bytes, size_t alignment) {
+    allocationCount_++;
+    bytesRequested_ += bytes;
+    return arena_.allocate(bytes, alignment);
+}
+
+void AnalysisArena::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+    // Monotonic: memory comes back only when the whole arena is released
+    arena_.deallocate(pointer, bytes, alignment);
+}
+
+bool AnalysisArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+void* AnalysisArena::CountingUpstream::do_allocate(size_t bytes, size_t alignment) {
+    blockCount++;
+    blockBytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void AnalysisArena::CountingUpstream::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+}
+
+bool AnalysisArena::CountingUpstream::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+//self written code end
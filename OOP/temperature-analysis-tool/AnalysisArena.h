@@ -0,0 +1,63 @@
+#ifndef ANALYSIS_ARENA_H
+#define ANALYSIS_ARENA_H
+
+#include <memory_resource>
+#include <cstddef>
+
+//self written code start
+/**
+ *  Monotonic memory arena for the temporaries of one analysis.
+ *
+ * Allocations are carved out of a few large blocks and never freed
+ * individually; everything is returned in one shot by release() or the
+ * destructor. Loading, aggregation and filtering therefore cost a handful of
+ * heap allocations per analysis instead of one per container, and a
+ * long-running session does not fragment the heap with short-lived buffers.
+ * Not thread-safe: allocate only from the thread that owns the arena.
+ */
+class AnalysisArena : public std::pmr::memory_resource {
+public:
+    explicit AnalysisArena(size_t initialBlockBytes = 64 * 1024);
+    ~AnalysisArena() override = default;
+
+    AnalysisArena(const AnalysisArena&) = delete;
+    AnalysisArena& operator=(const AnalysisArena&) = delete;
+
+    std::pmr::memory_resource* resource() { return this; }
+
+    /**
+     *  Frees every block at once; containers using the arena must be gone.
+     */
+    void release();
+
+    // Counters since construction or the last release()
+    size_t allocationCount() const { return allocationCount_; }
+    size_t bytesRequested() const { return bytesRequested_; }
+    size_t blockCount() const { return upstream_.blockCount; }
+    size_t blockBytes() const { return upstream_.blockBytes; }
+
+private:
+    /**
+     *  Heap resource that counts the blocks the arena takes from it.
+     */
+    struct CountingUpstream : std::pmr::memory_resource {
+        size_t blockCount{0};
+        size_t blockBytes{0};
+
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+    };
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    CountingUpstream upstream_;
+    std::pmr::monotonic_buffer_resource arena_;
+    size_t allocationCount_;
+    size_t bytesRequested_;
+};
+
+#endif
+//self written code end
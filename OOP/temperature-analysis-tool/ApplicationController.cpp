@@ -5,12 +5,48 @@
 #include "DataFilter.h"
 #include "UserInput.h"
 #include "Prediction.h"
+#include "CandlestickAggregator.h"
+#include "AnalysisArena.h"
+#include "FileStamp.h"
+#include "TimeGrid.h"
 #include <iostream>
 #include <exception>
+#include <algorithm>
+
+#ifndef _WIN32
+    #include <sys/resource.h>
+#endif
 
 //self written code start
-ApplicationController::ApplicationController(const std::string& dataFilePath) 
-    : dataFilePath_(dataFilePath) {
+namespace {
+    /**
+     *  Peak resident set size of the process so far, or 0 where it is not available.
+     */
+    size_t peakResidentBytes() {
+#ifndef _WIN32
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+            return static_cast<size_t>(usage.ru_maxrss);            // bytes
+#else
+            return static_cast<size_t>(usage.ru_maxrss) * 1024;     // KiB
+#endif
+        }
+#endif
+        return 0;
+    }
+    
+    void reportArenaUsage(const AnalysisArena& arena) {
+        std::cout << "Analysis memory: " << arena.allocationCount() << " allocations served from "
+                  << arena.blockCount() << " arena blocks (" << arena.blockBytes() / 1024
+                  << " KiB), released together\n";
+    }
+}
+
+ApplicationController::ApplicationController(const std::string& dataFilePath, bool followMode,
+                                             size_t memoryBudgetBytes, unsigned threadCount) 
+    : dataFilePath_(dataFilePath), followMode_(followMode), memoryBudgetBytes_(memoryBudgetBytes),
+      threadCount_(threadCount) {
 }
 
 int ApplicationController::run() {
@@ -44,7 +80,9 @@ bool ApplicationController::performSingleAnalysis() {
     // Get user input
     std::cout << "=== STARTING NEW ANALYSIS ===\n\n";
     
-    std::string country = UserInput::getCountryCode();
+    // The catalog is parsed once per data file and shared with the loaders
+    const auto catalog = DataLoader::loadCatalog(dataFilePath_);
+    std::string country = UserInput::getCountryCode(catalog.get());
     UserInput::clearScreen();
     
     int startYear, endYear;
@@ -54,8 +92,11 @@ bool ApplicationController::performSingleAnalysis() {
     TimeFrame timeframe = UserInput::getTimeFrame();
     UserInput::clearScreen();
     
+    // Every temporary of this analysis lives in the arena and is freed in one shot on return
+    AnalysisArena arena;
+    
     // Load and process data
-    std::vector<Candlestick> candlesticks;
+    CandlestickSeries candlesticks(arena.resource());
     if (!loadAndProcessData(country, startYear, endYear, timeframe, candlesticks)) {
         UserInput::waitForUser();
         return true; // Continue to next analysis
@@ -64,8 +105,8 @@ bool ApplicationController::performSingleAnalysis() {
     // Display initial results
     displayInitialResults(candlesticks, timeframe, country, startYear, endYear);
     
-    // Handle filtering workflow
-    std::vector<Candlestick> dataForAnalysis = candlesticks;
+    // Handle filtering workflow; the working set starts as a view of the loaded candles
+    CandlestickSeries dataForAnalysis = candlesticks;
     bool wasFiltered = handleFilteringWorkflow(dataForAnalysis, candlesticks, timeframe, country);
     
     // Handle prediction workflow
@@ -80,48 +121,124 @@ bool ApplicationController::performSingleAnalysis() {
         UserInput::waitForUser();
     }
     
+    reportArenaUsage(arena);
+    
     // Ask if user wants to continue
     return UserInput::askToAnalyzeAnotherCountry();
 }
 
 bool ApplicationController::loadAndProcessData(const std::string& country, int startYear, int endYear,
-                                             TimeFrame timeframe, std::vector<Candlestick>& candlesticks) {
+                                             TimeFrame timeframe, CandlestickSeries& candlesticks) {
     // Load temperature records
     std::cout << "=== LOADING DATA ===\n";
     std::cout << "Loading temperature data for " << country 
               << " from " << startYear << " to " << endYear << "...\n";
     
-    std::vector<TemperatureRecord> records = DataLoader::loadCSV(dataFilePath_, country, startYear, endYear);
+    if (memoryBudgetBytes_ > 0 && !followMode_) {
+        return aggregateInBatches(country, startYear, endYear, timeframe, candlesticks);
+    }
+    
+    // Shared by the rollups of a plain load and the text records kept in follow mode
+    const auto processRecords = [&](size_t recordCount, const auto& computeCandles) {
+        if (recordCount == 0) {
+            std::cout << "\n Error: No data found for the specified criteria.\n";
+            std::cout << "Possible issues:\n";
+            std::cout << "  • Country code '" << country << "' might not exist in the dataset\n";
+            std::cout << "  • Year range " << startYear << "-" << endYear << " might have no data\n";
+            std::cout << "  • Data file might be corrupted or in wrong format\n";
+            std::cout << "\nPlease try different parameters.\n";
+            return false;
+        }
+        
+        std::cout << " Successfully loaded " << recordCount << " temperature records\n";
+        
+        // Process into candlesticks
+        std::cout << "\n=== PROCESSING DATA ===\n";
+        std::cout << "Computing candlestick aggregation using " 
+                  << Utils::timeFrameToString(timeframe) << " timeframe...\n";
+        
+        candlesticks = CandlestickSeries(computeCandles(), timeframe, candlesticks.resource());
+        
+        if (candlesticks.empty()) {
+            std::cout << " Error: Failed to compute candlestick data from records.\n";
+            return false;
+        }
+        
+        std::cout << " Successfully computed " << candlesticks.size() << " candlestick entries.\n";
+        
+        // Data quality warnings
+        if (recordCount < 10) {
+            std::cout << "⚠ Warning: Very limited data (" << recordCount 
+                      << " records). Results may be less reliable.\n";
+        }
+        
+        UserInput::waitForUser();
+        return true;
+    };
+    
+    if (followMode_) {
+        const IncrementalCandlesticks& live = followCandles(country, startYear, endYear, timeframe);
+        return processRecords(live.recordCount(), [&]() { return live.candlesticks(timeframe); });
+    }
     
-    if (records.empty()) {
+    // The same selection of an unchanged file is served from the previous load's rollups,
+    // so changing timeframe does not reread or rescan the readings
+    const std::string selection = country + ":" + std::to_string(startYear) + "-" + std::to_string(endYear);
+    FileStamp stamp;
+    const bool stamped = FileStamp::read(dataFilePath_, stamp);
+    if (stamped && selection == pyramidSelection_ && stamp == pyramidStamp_ && !pyramid_.empty()) {
+        std::cout << "Reusing the daily rollups of the previous load (" << pyramid_.dayCount() << " days)\n";
+    } else {
+        // 8-byte records in the caller's arena; only the daily partials outlive this analysis
+        DataLoader::LoaderConfig config;
+        config.threadCount = threadCount_;
+        std::pmr::vector<CompactTemperatureRecord> records(candlesticks.resource());
+        DataLoader::loadCompact(dataFilePath_, country, startYear, endYear, records, config);
+        pyramid_ = RollupPyramid(records, threadCount_);
+        pyramidSelection_ = stamped ? selection : std::string();
+        pyramidStamp_ = stamp;
+    }
+    return processRecords(pyramid_.recordCount(), [&]() { return pyramid_.candlesticks(timeframe); });
+}
+
+/**
+ *  Out-of-core path: record batches go straight from the loader into a
+ * streaming aggregator, so peak memory is bounded by the batch budget plus
+ * the candles rather than by the size of the data file.
+ */
+bool ApplicationController::aggregateInBatches(const std::string& country, int startYear, int endYear,
+                                               TimeFrame timeframe, CandlestickSeries& candlesticks) {
+    std::cout << "Computing " << Utils::timeFrameToString(timeframe) 
+              << " candlesticks while streaming record batches...\n";
+    
+    DataLoader::LoaderConfig config;
+    config.memoryBudgetBytes = memoryBudgetBytes_;
+    
+    CandlestickAggregator aggregator(timeframe);
+    const DataLoader::BatchLoadStats stats = DataLoader::loadCSVBatches(
+        dataFilePath_, country, startYear, endYear,
+        [&aggregator](const std::vector<TemperatureRecord>& batch) { aggregator.add(batch); },
+        config);
+    
+    if (!stats.succeeded || stats.recordCount == 0) {
         std::cout << "\n Error: No data found for the specified criteria.\n";
-        std::cout << "Possible issues:\n";
-        std::cout << "  • Country code '" << country << "' might not exist in the dataset\n";
-        std::cout << "  • Year range " << startYear << "-" << endYear << " might have no data\n";
-        std::cout << "  • Data file might be corrupted or in wrong format\n";
         std::cout << "\nPlease try different parameters.\n";
         return false;
     }
     
-    std::cout << " Successfully loaded " << records.size() << " temperature records\n";
-    
-    // Process into candlesticks
-    std::cout << "\n=== PROCESSING DATA ===\n";
-    std::cout << "Computing candlestick aggregation using " 
-              << Utils::timeFrameToString(timeframe) << " timeframe...\n";
-    
-    candlesticks = CandlestickCalculator::computeCandlesticks(records, timeframe);
+    candlesticks = CandlestickSeries(aggregator.finish(), timeframe, candlesticks.resource());
     
-    if (candlesticks.empty()) {
-        std::cout << " Error: Failed to compute candlestick data from records.\n";
-        return false;
+    std::cout << " Successfully aggregated " << stats.recordCount << " temperature records into "
+              << candlesticks.size() << " candlestick entries.\n";
+    std::cout << " Peak memory: loader " << stats.peakLoaderBytes / 1024 << " KiB, aggregator "
+              << aggregator.memoryUsage() / 1024 << " KiB";
+    if (const size_t residentBytes = peakResidentBytes()) {
+        std::cout << ", process peak RSS " << residentBytes / (1024 * 1024) << " MiB";
     }
+    std::cout << "\n";
     
-    std::cout << " Successfully computed " << candlesticks.size() << " candlestick entries.\n";
-    
-    // Data quality warnings
-    if (records.size() < 10) {
-        std::cout << "⚠ Warning: Very limited data (" << records.size() 
+    if (stats.recordCount < 10) {
+        std::cout << "⚠ Warning: Very limited data (" << stats.recordCount 
                   << " records). Results may be less reliable.\n";
     }
     
@@ -129,7 +246,69 @@ bool ApplicationController::loadAndProcessData(const std::string& country, int s
     return true;
 }
 
-void ApplicationController::displayInitialResults(const std::vector<Candlestick>& candlesticks,
+/**
+ *  Brings the followed selection up to date. Analysing the same country and
+ * years again only parses the rows appended to the file since the last load
+ * and folds them into the open candles, so no history is recomputed; a new
+ * selection, a truncated or replaced file, or appended rows older than the
+ * loaded ones cause a full load.
+ */
+const IncrementalCandlesticks& ApplicationController::followCandles(const std::string& country,
+                                                                    int startYear, int endYear,
+                                                                    TimeFrame timeframe) {
+    const std::string selection = country + ":" + std::to_string(startYear) + "-" + std::to_string(endYear);
+    if (selection != followedSelection_) {
+        followedSelection_ = selection;
+        followState_ = DataLoader::FollowState();
+        followedCandles_.clear();
+    }
+    
+    std::vector<TemperatureRecord> newRecords;
+    switch (DataLoader::loadAppended(dataFilePath_, country, startYear, endYear, followState_, newRecords)) {
+        case DataLoader::FollowStatus::Reloaded: {
+            // A full load is folded in time order, as computeCandlesticks would sort it
+            followedCandles_.clear();
+            std::vector<const TemperatureRecord*> ordered;
+            ordered.reserve(newRecords.size());
+            for (const auto& record : newRecords) {
+                ordered.push_back(&record);
+            }
+            std::stable_sort(ordered.begin(), ordered.end(),
+                             [](const TemperatureRecord* a, const TemperatureRecord* b) { return a->date < b->date; });
+            for (const TemperatureRecord* record : ordered) {
+                followedCandles_.append(*record);
+            }
+            break;
+        }
+        case DataLoader::FollowStatus::Appended: {
+            const size_t closedBefore = followedCandles_.closedCandlesticks(timeframe).size();
+            for (const auto& record : newRecords) {
+                if (!followedCandles_.append(record)) {
+                    std::cout << "Follow mode: appended rows are older than the loaded ones; reloading the selection\n";
+                    followState_ = DataLoader::FollowState();
+                    followedCandles_.clear();
+                    return followCandles(country, startYear, endYear, timeframe);
+                }
+            }
+            std::cout << "Follow mode: " << newRecords.size() << " new records since the last load, "
+                      << followedCandles_.closedCandlesticks(timeframe).size() - closedBefore << " "
+                      << Utils::timeFrameToString(timeframe) << " candles closed\n";
+            break;
+        }
+        case DataLoader::FollowStatus::Unchanged:
+            std::cout << "Follow mode: no new rows since the last load\n";
+            break;
+        case DataLoader::FollowStatus::Failed:
+        default:
+            followedSelection_.clear();
+            followState_ = DataLoader::FollowState();
+            followedCandles_.clear();
+            break;
+    }
+    return followedCandles_;
+}
+
+void ApplicationController::displayInitialResults(const CandlestickSeries& candlesticks,
                                                  TimeFrame timeframe, const std::string& country,
                                                  int startYear, int endYear) {
     UserInput::clearScreen();
@@ -141,8 +320,8 @@ void ApplicationController::displayInitialResults(const std::vector<Candlestick>
     displayChartAndTable(candlesticks, timeframe, country, chartTitle);
 }
 
-bool ApplicationController::handleFilteringWorkflow(std::vector<Candlestick>& dataForAnalysis,
-                                                   const std::vector<Candlestick>& originalData,
+bool ApplicationController::handleFilteringWorkflow(CandlestickSeries& dataForAnalysis,
+                                                   const CandlestickSeries& originalData,
                                                    TimeFrame timeframe, const std::string& country) {
     if (!UserInput::askForFiltering()) {
         return false;
@@ -188,9 +367,9 @@ bool ApplicationController::handleFilteringWorkflow(std::vector<Candlestick>& da
             UserInput::clearScreen();
             
             // Apply filter to appropriate source data
-            std::vector<Candlestick> sourceData = (mode == 1) ? dataForAnalysis : originalData;
-            std::vector<Candlestick> filtered = applyFilter(
-                std::move(sourceData), filterType, startDate, endDate, 
+            const CandlestickSeries& sourceData = (mode == 1) ? dataForAnalysis : originalData;
+            CandlestickSeries filtered = applyFilter(
+                sourceData, filterType, startDate, endDate, 
                 minTemp, maxTemp, uptrend, minVolatility
             );
             
@@ -216,7 +395,7 @@ bool ApplicationController::handleFilteringWorkflow(std::vector<Candlestick>& da
             
             UserInput::clearScreen();
             
-            std::vector<Candlestick> filtered = applyFilter(
+            CandlestickSeries filtered = applyFilter(
                 originalData, filterType, startDate, endDate, 
                 minTemp, maxTemp, uptrend, minVolatility
             );
@@ -243,10 +422,17 @@ bool ApplicationController::handleFilteringWorkflow(std::vector<Candlestick>& da
     return filtersApplied > 0;
 }
 
-void ApplicationController::handlePredictionWorkflow(const std::vector<Candlestick>& dataForAnalysis,
-                                                   const std::vector<Candlestick>& originalData,
+void ApplicationController::handlePredictionWorkflow(const CandlestickSeries& dataForAnalysis,
+                                                   const CandlestickSeries& originalData,
                                                    TimeFrame timeframe, const std::string& country,
                                                    int startYear, int endYear, bool wasFiltered) {
+    // The 24 hour-of-day candles are a profile of one average day, not a time series to extrapolate
+    if (TimeGrid::isCyclic(timeframe)) {
+        std::cout << "\nPredictions are not available for " << Utils::timeFrameToString(timeframe)
+                  << " data: its candles are the hours of an average day, not a time series.\n";
+        return;
+    }
+
     if (!UserInput::askForPredictions()) {
         return;
     }
@@ -308,8 +494,8 @@ bool ApplicationController::handleException(const std::exception& e, const std::
 }
 
 // Static helper methods
-std::vector<Candlestick> ApplicationController::applyFilter(
-    std::vector<Candlestick> data,
+CandlestickSeries ApplicationController::applyFilter(
+    const CandlestickSeries& data,
     FilterType filterType,
     const std::string& startDate,
     const std::string& endDate,
@@ -333,7 +519,7 @@ std::vector<Candlestick> ApplicationController::applyFilter(
     }
 }
 
-void ApplicationController::displayChartAndTable(const std::vector<Candlestick>& data, 
+void ApplicationController::displayChartAndTable(const CandlestickSeries& data, 
                                                TimeFrame timeframe, 
                                                const std::string& country, 
                                                const std::string& chartTitle) {
@@ -348,7 +534,7 @@ void ApplicationController::displayChartAndTable(const std::vector<Candlestick>&
     }
 }
 
-void ApplicationController::displayPredictions(const std::vector<Candlestick>& data, 
+void ApplicationController::displayPredictions(const CandlestickSeries& data, 
                                              TimeFrame timeframe, 
                                              const std::string& country, 
                                              int startYear, int endYear) {
@@ -4,8 +4,12 @@
 #include <vector>
 #include <string>
 #include "Common.h"
-#include "Candlestick.h"
+#include "CandlestickSeries.h"
 #include "TemperatureRecord.h"
+#include "DataLoader.h"
+#include "FileStamp.h"
+#include "RollupPyramid.h"
+#include "IncrementalCandlesticks.h"
 
 
 //self written code start
@@ -20,8 +24,13 @@ public:
     /**
      *  Constructs the application controller with data file path
      * @param dataFilePath Path to the CSV data file
+     * @param followMode Keep the loaded selection and only parse rows appended to the file since
+     * @param memoryBudgetBytes If non-zero, stream records into the aggregator in batches within this budget
+     * @param threadCount Threads for parsing and for the rollup pass over a full load
+     *        (unused by --follow and --memory-budget, which run serially), 0 = one per hardware thread
      */
-    explicit ApplicationController(const std::string& dataFilePath);
+    explicit ApplicationController(const std::string& dataFilePath, bool followMode = false,
+                                   size_t memoryBudgetBytes = 0, unsigned threadCount = 0);
     
     /**
      *  Runs the main application loop
@@ -33,15 +42,19 @@ private:
     // Core workflow methods
     bool performSingleAnalysis();
     bool loadAndProcessData(const std::string& country, int startYear, int endYear, 
-                           TimeFrame timeframe, std::vector<Candlestick>& candlesticks);
-    void displayInitialResults(const std::vector<Candlestick>& candlesticks, 
+                           TimeFrame timeframe, CandlestickSeries& candlesticks);
+    const IncrementalCandlesticks& followCandles(const std::string& country, int startYear, int endYear,
+                                                 TimeFrame timeframe);
+    bool aggregateInBatches(const std::string& country, int startYear, int endYear,
+                            TimeFrame timeframe, CandlestickSeries& candlesticks);
+    void displayInitialResults(const CandlestickSeries& candlesticks, 
                               TimeFrame timeframe, const std::string& country,
                               int startYear, int endYear);
-    bool handleFilteringWorkflow(std::vector<Candlestick>& dataForAnalysis,
-                                const std::vector<Candlestick>& originalData,
+    bool handleFilteringWorkflow(CandlestickSeries& dataForAnalysis,
+                                const CandlestickSeries& originalData,
                                 TimeFrame timeframe, const std::string& country);
-    void handlePredictionWorkflow(const std::vector<Candlestick>& dataForAnalysis,
-                                 const std::vector<Candlestick>& originalData,
+    void handlePredictionWorkflow(const CandlestickSeries& dataForAnalysis,
+                                 const CandlestickSeries& originalData,
                                  TimeFrame timeframe, const std::string& country,
                                  int startYear, int endYear, bool wasFiltered);
     
@@ -53,9 +66,27 @@ private:
     // Member variables
     std::string dataFilePath_;
     
+    // Follow mode: the last selection's candles for every timeframe, kept current by
+    // parsing only appended rows and folding them in one at a time
+    bool followMode_;
+    std::string followedSelection_;
+    DataLoader::FollowState followState_;
+    IncrementalCandlesticks followedCandles_;
+    
+    // Out-of-core mode: 0 loads every record into memory first
+    size_t memoryBudgetBytes_;
+    
+    // Parser threads and rollup pass threads, 0 = one per hardware thread
+    unsigned threadCount_;
+    
+    // Rollups of the last plain load, reused while the selection and the file are unchanged
+    RollupPyramid pyramid_;
+    std::string pyramidSelection_;
+    FileStamp pyramidStamp_;
+    
     // Static helper methods
-    static std::vector<Candlestick> applyFilter(
-        std::vector<Candlestick> data,
+    static CandlestickSeries applyFilter(
+        const CandlestickSeries& data,
         FilterType filterType,
         const std::string& startDate,
         const std::string& endDate,
@@ -65,12 +96,12 @@ private:
         double minVolatility
     );
     
-    static void displayChartAndTable(const std::vector<Candlestick>& data, 
+    static void displayChartAndTable(const CandlestickSeries& data, 
                                    TimeFrame timeframe, 
                                    const std::string& country, 
                                    const std::string& chartTitle = "");
     
-    static void displayPredictions(const std::vector<Candlestick>& data, 
+    static void displayPredictions(const CandlestickSeries& data, 
                                  TimeFrame timeframe, 
                                  const std::string& country, 
                                  int startYear, int endYear);
@@ -1,6 +1,50 @@
 #include "Candlestick.h"
 
-Candlestick::Candlestick() : date_(""), open_(0), close_(0), high_(0), low_(0) {}
+Candlestick::Candlestick() : dateKey_(0), hour_(0), open_(0), close_(0), high_(0), low_(0) {}
 
 Candlestick::Candlestick(const std::string& date, double open, double close, double high, double low)
-    : date_(date), open_(open), close_(close), high_(high), low_(low) {}
\ No newline at end of file
+    : dateKey_(0), hour_(0), open_(open), close_(close), high_(high), low_(low) {
+    //self written code start
+    if (!parseDateKey(date, dateKey_)) {
+        dateKey_ = 0;
+    }
+    //self written code end
+}
+
+//self written code start
+Candlestick::Candlestick(const DateTime& date, double open, double close, double high, double low)
+    : dateKey_(packDate(date.year, date.month, date.day)), hour_(date.hour), open_(open), close_(close), high_(high), low_(low) {}
+
+bool Candlestick::parseDateKey(std::string_view text, int32_t& key) {
+    if (text.size() < 10 || text[4] != '-' || text[7] != '-') {
+        return false;
+    }
+    
+    int32_t value = 0;
+    for (size_t i = 0; i < 10; ++i) {
+        if (i == 4 || i == 7) continue;
+        if (text[i] < '0' || text[i] > '9') return false;
+        value = value * 10 + (text[i] - '0');
+    }
+    key = value;
+    return true;
+}
+
+DateTime Candlestick::unpackDate(int32_t key) {
+    DateTime date;
+    date.year = static_cast<int16_t>(key / 10000);
+    date.month = static_cast<uint8_t>(key / 100 % 100);
+    date.day = static_cast<uint8_t>(key % 100);
+    return date;
+}
+
+std::string Candlestick::formatDateKey(int32_t key) {
+    if (key == 0) {
+        return std::string();
+    }
+    
+    char buffer[10];
+    unpackDate(key).formatDate(buffer);
+    return std::string(buffer, sizeof(buffer));
+}
+//self written code end
@@ -2,10 +2,18 @@
 #define CANDLESTICK_H
 
 #include <string>
+#include <string_view>
+#include <cstdint>
+#include "DateTime.h"
 
 class Candlestick {
 private:
-    std::string date_;
+    int32_t dateKey_;
+    //self written code start
+    // Hour of the period start; only hour-of-day candles start off midnight.
+    // Sits in the padding after dateKey_, so a candle stays 40 bytes.
+    uint8_t hour_;
+    //self written code end
     double open_;
     double close_;
     double high_;
@@ -14,9 +22,47 @@ private:
 public:
     Candlestick();
     Candlestick(const std::string& date, double open, double close, double high, double low);
-
+    //self written code start
+    Candlestick(const DateTime& date, double open, double close, double high, double low);
+    
+    /**
+     *  Packs a date as the integer YYYYMMDD, which orders the same way as the
+     * "YYYY-MM-DD" text it stands for.
+     */
+    static constexpr int32_t packDate(int year, int month, int day) {
+        return year * 10000 + month * 100 + day;
+    }
+    
+    /**
+     *  Reads the leading "YYYY-MM-DD" of text into a packed date key.
+     * Only the digit layout is checked, so the key compares exactly like the text did.
+     * @return false if text does not start with that layout.
+     */
+    static bool parseDateKey(std::string_view text, int32_t& key);
+    static DateTime unpackDate(int32_t key);
+    
+    /**
+     *  "YYYY-MM-DD" text of a packed date key (empty for 0).
+     */
+    static std::string formatDateKey(int32_t key);
+    
     // Getters
-    std::string getDate() const { return date_; }
+    /**
+     *  Packed YYYYMMDD date of the period start (0 if unset); cheap to copy and compare.
+     */
+    int32_t getDateKey() const { return dateKey_; }
+    DateTime getDateTime() const {
+        DateTime date = unpackDate(dateKey_);
+        date.hour = hour_;
+        return date;
+    }
+    
+    /**
+     *  Formats the date as "YYYY-MM-DD" (empty if unset). Allocates, so it is
+     * meant for display and export only; compare with getDateKey().
+     */
+    std::string getDate() const { return formatDateKey(dateKey_); }
+    //self written code end
     double getOpen() const { return open_; }
     double getClose() const { return close_; }
     double getHigh() const { return high_; }
@@ -40,4 +86,4 @@ public:
     double getAverage() const { return close_; }
 };
 
-#endif
\ No newline at end of file
+#endif
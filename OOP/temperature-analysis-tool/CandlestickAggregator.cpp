@@ -0,0 +1,78 @@
+#include "CandlestickAggregator.h"
+#include "TimeGrid.h"
+
+//self written code start
+CandlestickAggregator::CandlestickAggregator(TimeFrame timeframe)
+    : timeframe_(timeframe), current_(nullptr), currentPeriod_(0), recordCount_(0) {
+}
+
+void CandlestickAggregator::add(const TemperatureRecord& record) {
+    add(record.date, record.temperature);
+}
+
+void CandlestickAggregator::add(const std::string& dateTime, double temperature) {
+    // Periods are keyed by their grid index, so a record costs a date parse
+    // but no key text
+    DateTime date;
+    char separator;
+    size_t consumed;
+    if (!DateTime::parse(dateTime, date, separator, consumed)) {
+        return;
+    }
+
+    // Chronological input stays in one period for many records in a row;
+    // only a change of period needs a map lookup
+    const int32_t period = TimeGrid::periodIndex(date, timeframe_);
+    if (current_ == nullptr || period != currentPeriod_) {
+        current_ = &periods_[period];
+        currentPeriod_ = period;
+    }
+
+    Partial& partial = *current_;
+    if (partial.count == 0) {
+        partial.high = temperature;
+        partial.low = temperature;
+    }
+    partial.sum += temperature;
+    if (temperature > partial.high) partial.high = temperature;
+    if (temperature < partial.low) partial.low = temperature;
+    partial.count++;
+    recordCount_++;
+}
+
+void CandlestickAggregator::add(const std::vector<TemperatureRecord>& records) {
+    for (const auto& record : records) {
+        add(record);
+    }
+}
+
+std::vector<Candlestick> CandlestickAggregator::finish() const {
+    std::vector<Candlestick> candlesticks;
+    candlesticks.reserve(periods_.size());
+
+    // Track previous period's average for correct "open" calculation
+    double previousPeriodAverage = 0.0;
+    bool hasPreviousPeriod = false;
+
+    for (const auto& [period, partial] : periods_) {
+        const double currentPeriodAverage = partial.sum / partial.count;
+
+        // For the first period, use the current period's average as both open and close
+        const double open = hasPreviousPeriod ? previousPeriodAverage : currentPeriodAverage;
+
+        candlesticks.emplace_back(TimeGrid::periodStart(period, timeframe_),
+                                  open, currentPeriodAverage, partial.high, partial.low);
+
+        previousPeriodAverage = currentPeriodAverage;
+        hasPreviousPeriod = true;
+    }
+
+    return candlesticks;
+}
+
+size_t CandlestickAggregator::memoryUsage() const {
+    // Red-black tree node: three pointers and a colour word besides the value
+    constexpr size_t NODE_OVERHEAD = 4 * sizeof(void*);
+    return periods_.size() * (sizeof(std::pair<const int32_t, Partial>) + NODE_OVERHEAD);
+}
+//self written code end
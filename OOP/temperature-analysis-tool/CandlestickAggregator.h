@@ -0,0 +1,66 @@
+#ifndef CANDLESTICK_AGGREGATOR_H
+#define CANDLESTICK_AGGREGATOR_H
+
+#include <vector>
+#include <string>
+#include <map>
+#include <cstddef>
+#include <cstdint>
+#include "Candlestick.h"
+#include "TemperatureRecord.h"
+#include "Common.h"
+
+//self written code start
+/**
+ *  Streaming candlestick aggregation.
+ *
+ * Records are folded into a running sum, minimum, maximum and count per
+ * period as they arrive, so the input never has to be held in memory: only
+ * one small partial per output candle is kept. Records may arrive in any
+ * order; in-order input needs one map lookup per period, not per record.
+ * finish() applies the same rules as CandlestickCalculator::computeCandlesticks
+ * (periods in chronological order, open = previous period's average).
+ */
+class CandlestickAggregator {
+public:
+    explicit CandlestickAggregator(TimeFrame timeframe);
+
+    // Holds a pointer into its own map, so it moves but does not copy
+    CandlestickAggregator(const CandlestickAggregator&) = delete;
+    CandlestickAggregator& operator=(const CandlestickAggregator&) = delete;
+    CandlestickAggregator(CandlestickAggregator&&) = default;
+    CandlestickAggregator& operator=(CandlestickAggregator&&) = default;
+
+    void add(const TemperatureRecord& record);
+    void add(const std::string& dateTime, double temperature);
+    void add(const std::vector<TemperatureRecord>& records);
+
+    std::vector<Candlestick> finish() const;
+
+    size_t recordCount() const { return recordCount_; }
+    size_t periodCount() const { return periods_.size(); }
+
+    /**
+     *  Approximate heap bytes held by the per-period partials.
+     */
+    size_t memoryUsage() const;
+
+private:
+    struct Partial {
+        double sum{0.0};
+        double high{0.0};
+        double low{0.0};
+        size_t count{0};
+    };
+
+    TimeFrame timeframe_;
+    // Keyed by TimeGrid period index, which orders periods chronologically
+    std::map<int32_t, Partial> periods_;
+    // Partial of the most recent record's period (map nodes never move)
+    Partial* current_;
+    int32_t currentPeriod_;
+    size_t recordCount_;
+};
+
+#endif
+//self written code end
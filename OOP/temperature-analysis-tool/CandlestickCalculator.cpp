@@ -1,9 +1,12 @@
 #include "CandlestickCalculator.h"
+#include "CandlestickAggregator.h"
 #include "Common.h"
+#include "TimeGrid.h"
+#include "ParallelAggregation.h"
 #include <algorithm>
-#include <map>
 #include <iostream>
 #include <iomanip>
+#include <string_view>
 
 /*self written code start (code built with reference to : 
  https://github.com/KC1922/StockMarketDisplay-CPP/tree/main/StockProjectCPP
@@ -18,108 +21,250 @@ namespace CandlestickCalculator {
  * vector of Candlestick objects. 
  * 
  * @param records A vector of TemperatureRecord structs.
- * @param timeframe The time frame (Yearly, Monthly, Daily) to group data by.
+ * @param timeframe The time frame (Yearly, Seasonal, Quarterly, Monthly, Weekly,
+ *        Daily or HourOfDay) to group data by.
  * @return A vector of Candlestick objects.
  */
 std::vector<Candlestick> computeCandlesticks(const std::vector<TemperatureRecord>& records, TimeFrame timeframe) {
-    std::vector<Candlestick> candlesticks;
     if (records.empty()) {
-        return candlesticks;
+        return {};
+    }
+
+    // Group records by the specified timeframe; the aggregator keeps periods in chronological order
+    CandlestickAggregator aggregator(timeframe);
+
+    // Loader output is already in date order and is streamed straight through.
+    // Only an unordered input is sorted, and then through pointers, so no
+    // record (or its date string) is copied.
+    const auto byDate = [](const TemperatureRecord& a, const TemperatureRecord& b) {
+        return a.date < b.date;
+    };
+    if (std::is_sorted(records.begin(), records.end(), byDate)) {
+        aggregator.add(records);
+        return aggregator.finish();
     }
 
-    std::vector<TemperatureRecord> sortedRecords;
+    std::vector<const TemperatureRecord*> sortedRecords;
     sortedRecords.reserve(records.size());
     for (const auto& record : records) {
-        sortedRecords.emplace_back(record);
+        sortedRecords.push_back(&record);
+    }
+    std::stable_sort(sortedRecords.begin(), sortedRecords.end(),
+                     [&byDate](const TemperatureRecord* a, const TemperatureRecord* b) {
+                         return byDate(*a, *b);
+                     });
+    for (const TemperatureRecord* record : sortedRecords) {
+        aggregator.add(*record);
     }
     
-    std::sort(sortedRecords.begin(), sortedRecords.end(), 
-              [](const TemperatureRecord& a, const TemperatureRecord& b) {
-                  return a.date < b.date;
-              });
+    return aggregator.finish();
+}
 
-    // Group records by the specified timeframe - using ordered map to maintain chronological order
-    std::map<std::string, std::vector<double>> groupedData;
-    
-    for (const auto& record : sortedRecords) {
-        std::string groupKey = getGroupKey(record.date, timeframe);
-        if (!groupKey.empty()) {
-            auto& temperatures = groupedData[groupKey];
-            temperatures.emplace_back(record.temperature);
+namespace {
+    /**
+     *  Running aggregate of one period.
+     */
+    struct PeriodPartial {
+        DateTime start;
+        double sum{0.0};
+        double high{0.0};
+        double low{0.0};
+        size_t count{0};
+    };
+
+    /**
+     *  Grid index of the period containing the reading at epochHours.
+     */
+    int32_t periodOfHour(int32_t epochHours, TimeFrame timeframe) {
+        return TimeGrid::periodIndex(DateTime::fromEpochHours(epochHours), timeframe);
+    }
+
+    /**
+     *  Folds time-ordered readings [first, last) into one partial per period,
+     * appended to partials in order. Calendar timeframes only.
+     */
+    template <typename Iterator>
+    void aggregateSlice(Iterator first, Iterator last, TimeFrame timeframe, std::vector<PeriodPartial>& partials) {
+        // The calendar conversion only runs when the day changes, i.e. once per 24 hourly rows
+        int32_t previousDay = 0;
+        int32_t previousDayPeriod = 0;
+        bool hasPreviousDay = false;
+        int32_t currentPeriod = 0;
+
+        for (; first != last; ++first) {
+            const int32_t day = TimeGrid::floorDivide(first->epochHours, 24);
+            if (!hasPreviousDay || day != previousDay) {
+                previousDayPeriod = TimeGrid::periodIndex(DateTime::fromEpochDays(day), timeframe);
+                previousDay = day;
+                hasPreviousDay = true;
+            }
+
+            const double temperature = first->temperature;
+            if (partials.empty() || previousDayPeriod != currentPeriod) {
+                currentPeriod = previousDayPeriod;
+                partials.push_back({TimeGrid::periodStart(currentPeriod, timeframe), 0.0, temperature, temperature, 0});
+            }
+
+            PeriodPartial& partial = partials.back();
+            partial.sum += temperature;
+            if (temperature > partial.high) partial.high = temperature;
+            if (temperature < partial.low) partial.low = temperature;
+            partial.count++;
         }
     }
 
-    // Reserve space for candlesticks to avoid reallocations
-    candlesticks.reserve(groupedData.size());
+    /**
+     *  Folds readings [first, last) into the 24 buckets of the hour-of-day
+     * profile and returns the non-empty ones in hour order. Every day touches
+     * every bucket, so the readings are summed in one serial pass in input
+     * order rather than in time slices.
+     */
+    template <typename Iterator>
+    std::vector<PeriodPartial> aggregateHoursOfDay(Iterator first, Iterator last) {
+        constexpr int32_t HOURS_PER_DAY = 24;
+        PeriodPartial hours[HOURS_PER_DAY];
+        for (; first != last; ++first) {
+            const int32_t day = TimeGrid::floorDivide(first->epochHours, HOURS_PER_DAY);
+            PeriodPartial& partial = hours[first->epochHours - day * HOURS_PER_DAY];
+            const double temperature = first->temperature;
+            if (partial.count == 0) {
+                partial.high = temperature;
+                partial.low = temperature;
+            }
+            partial.sum += temperature;
+            if (temperature > partial.high) partial.high = temperature;
+            if (temperature < partial.low) partial.low = temperature;
+            partial.count++;
+        }
 
-    // Track previous period's average for correct "open" calculation
-    double previousPeriodAverage = 0.0;
-    bool hasPreviousPeriod = false;
+        std::vector<PeriodPartial> partials;
+        for (int32_t hour = 0; hour < HOURS_PER_DAY; ++hour) {
+            if (hours[hour].count > 0) {
+                hours[hour].start = TimeGrid::periodStart(hour, TimeFrame::HourOfDay);
+                partials.push_back(hours[hour]);
+            }
+        }
+        return partials;
+    }
 
-    // Process each group to create a candlestick
-    for (const auto& group : groupedData) {
-        const std::string& dateKey = group.first;
-        const std::vector<double>& temperatures = group.second;
-        
-        if (temperatures.empty()) continue;
-        
-        double sum = 0.0;
-        double high = temperatures[0];
-        double low = temperatures[0];
-        
-        for (double temp : temperatures) {
-            sum += temp;
-            if (temp > high) high = temp;
-            if (temp < low) low = temp;
+    /**
+     *  Shared body of the compact overloads; an unsorted input is copied with
+     * the input's own allocator, so arena-backed records sort inside the arena.
+     * With more than one thread, contiguous time slices of a calendar
+     * timeframe are aggregated in parallel; slices start on period boundaries,
+     * so every period is summed by one thread in input order and the result
+     * matches the serial pass.
+     */
+    template <typename Allocator>
+    std::vector<Candlestick> aggregateCompact(const std::vector<CompactTemperatureRecord, Allocator>& records,
+                                              TimeFrame timeframe, unsigned threadCount) {
+        std::vector<Candlestick> candlesticks;
+        if (records.empty()) {
+            return candlesticks;
         }
-        
-        // Calculate current period's average temperature
-        double currentPeriodAverage = sum / temperatures.size();
-        
-        // Use previous period's average as "open"
-        // For the first period, use the current period's average as both open and close
-        double open = hasPreviousPeriod ? previousPeriodAverage : currentPeriodAverage;
-        
-        // Close is the average temperature for the current period
-        double close = currentPeriodAverage;
-        
-        std::string candlestickDate = formatDateLabel(dateKey, timeframe);
-        
-        // Use emplace_back to construct in place
-        candlesticks.emplace_back(std::move(candlestickDate), open, close, high, low);
-        
-        // Update for next iteration
-        previousPeriodAverage = currentPeriodAverage;
-        hasPreviousPeriod = true;
+
+        // Loader output is already in time order; only an unordered input is copied and sorted
+        const auto byTime = [](const CompactTemperatureRecord& a, const CompactTemperatureRecord& b) {
+            return a.epochHours < b.epochHours;
+        };
+        const std::vector<CompactTemperatureRecord, Allocator>* ordered = &records;
+        std::vector<CompactTemperatureRecord, Allocator> sortedRecords(records.get_allocator());
+        if (!std::is_sorted(records.begin(), records.end(), byTime)) {
+            sortedRecords = records;
+            std::stable_sort(sortedRecords.begin(), sortedRecords.end(), byTime);
+            ordered = &sortedRecords;
+        }
+
+        const auto& input = *ordered;
+        std::vector<std::vector<PeriodPartial>> slicePartials;
+        if (TimeGrid::isCyclic(timeframe)) {
+            slicePartials.push_back(aggregateHoursOfDay(input.begin(), input.end()));
+        } else {
+            const std::vector<size_t> boundaries = ParallelAggregation::splitAtKeyChanges(
+                input.size(), ParallelAggregation::sliceCount(threadCount, input.size()),
+                [&input, timeframe](size_t index) { return periodOfHour(input[index].epochHours, timeframe); });
+
+            slicePartials.resize(boundaries.size() - 1);
+            ParallelAggregation::forEachSlice(boundaries, [&](size_t slice, size_t begin, size_t end) {
+                aggregateSlice(input.begin() + begin, input.begin() + end, timeframe, slicePartials[slice]);
+            });
+        }
+
+        // Sequential final pass: chain each period's open to the previous period's average
+        double previousPeriodAverage = 0.0;
+        bool hasPreviousPeriod = false;
+        for (const auto& partials : slicePartials) {
+            for (const PeriodPartial& partial : partials) {
+                const double currentPeriodAverage = partial.sum / partial.count;
+                const double open = hasPreviousPeriod ? previousPeriodAverage : currentPeriodAverage;
+
+                candlesticks.emplace_back(partial.start, open, currentPeriodAverage, partial.high, partial.low);
+
+                previousPeriodAverage = currentPeriodAverage;
+                hasPreviousPeriod = true;
+            }
+        }
+
+        return candlesticks;
     }
+}
+
+std::vector<Candlestick> computeCandlesticks(const std::vector<CompactTemperatureRecord>& records, TimeFrame timeframe,
+                                             unsigned threadCount) {
+    return aggregateCompact(records, timeframe, threadCount);
+}
+
+std::vector<Candlestick> computeCandlesticks(const std::pmr::vector<CompactTemperatureRecord>& records, TimeFrame timeframe,
+                                             unsigned threadCount) {
+    return aggregateCompact(records, timeframe, threadCount);
+}
+
+std::vector<Candlestick> computeCandlesticks(const MultiCountryData& data, const CountrySeries& series, TimeFrame timeframe) {
+    // The shared date column is in file order, so no sort or record copy is needed
+    CandlestickAggregator aggregator(timeframe);
+    series.forEachReading([&](size_t dateIndex, double temperature) {
+        aggregator.add(data.dates[dateIndex], temperature);
+    });
     
-    return candlesticks;
+    return aggregator.finish();
 }
 
 /**
  *  Generates a key for grouping records based on the timeframe.
  * @param dateTime A string representing the date and time (e.g., "YYYY-MM-DD HH:MM:SS").
  * @param timeframe The timeframe for grouping.
- * @return A string key (e.g., "YYYY" for Yearly, "YYYY-MM" for Monthly).
+ * @return A string key (e.g., "YYYY" for Yearly, "YYYY-MM" for Monthly and the
+ *         first month of a quarter or season, "YYYY-MM-DD" for the Monday of a
+ *         week, "HH" for HourOfDay), or an empty string if dateTime does not
+ *         start with a valid date.
  */
 std::string getGroupKey(const std::string& dateTime, TimeFrame timeframe) {
-    if (dateTime.length() < 10) {
+    DateTime date;
+    char separator;
+    size_t consumed;
+    if (!DateTime::parse(dateTime, date, separator, consumed)) {
         return ""; // Invalid date format
     }
     
-    std::string year = dateTime.substr(0, 4);
-    std::string month = dateTime.substr(5, 2);
-    std::string day = dateTime.substr(8, 2);
-    
+    // The key is the leading part of the period's start date (its hour for
+    // hour-of-day)
+    char buffer[10];
+    const DateTime start = TimeGrid::truncate(date, timeframe);
+    start.formatDate(buffer);
     switch (timeframe) {
-        case TimeFrame::Yearly:
-            return year;
         case TimeFrame::Monthly:
-            return year + "-" + month;
+        case TimeFrame::Quarterly:
+        case TimeFrame::Seasonal:
+            return std::string(buffer, 7);
         case TimeFrame::Daily:
-            return year + "-" + month + "-" + day;
+        case TimeFrame::Weekly:
+            return std::string(buffer, 10);
+        case TimeFrame::HourOfDay:
+            DateTime::writeDigits(buffer, start.hour, 2);
+            return std::string(buffer, 2);
+        case TimeFrame::Yearly:
         default:
-            return year; // Default case
+            return std::string(buffer, 4);
     }
 }
 
@@ -127,28 +272,28 @@ std::string getGroupKey(const std::string& dateTime, TimeFrame timeframe) {
  *  Formats the group key into a standardized date label.
  * @param groupKey The key generated by getGroupKey.
  * @param timeframe The timeframe used for grouping.
- * @return A formatted date string (e.g., "YYYY-01-01").
+ * @return A formatted date string (e.g., "YYYY-01-01"), or an empty string if
+ *         groupKey is not a dated period key (hour-of-day keys carry no date).
  */
 std::string formatDateLabel(const std::string& groupKey, TimeFrame timeframe) {
-    switch (timeframe) {
-        case TimeFrame::Yearly:
-            return groupKey + "-01-01"; // Represents the start of the year
-        case TimeFrame::Monthly:
-            return groupKey + "-01"; // Represents the start of the month
-        case TimeFrame::Daily:
-            return groupKey;
-        default:
-            return groupKey + "-01-01"; // Default case
+    DateTime start;
+    if (!DateTime::parsePeriod(groupKey, start)) {
+        return "";
     }
+    
+    // Represents the start of the period
+    char buffer[10];
+    TimeGrid::truncate(start, timeframe).formatDate(buffer);
+    return std::string(buffer, sizeof(buffer));
 }
 
 /**
  *  Prints a formatted table of candlestick data to the console.
  * This is a display function and should be called separately from the
  * data computation logic.
- * @param candlesticks A vector of Candlestick objects to display.
+ * @param candlesticks The candlestick series to display.
  */
-void printCandlestickTable(const std::vector<Candlestick>& candlesticks) {
+void printCandlestickTable(const CandlestickSeries& candlesticks) {
     if (candlesticks.empty()) {
         std::cout << "No candlestick data to display.\n";
         return;
@@ -165,10 +310,12 @@ void printCandlestickTable(const std::vector<Candlestick>& candlesticks) {
     std::cout << std::string(Constants::TABLE_SEPARATOR_WIDTH, '-') << "\n";
     
     // Table Body
+    char date[10];
     for (const auto& candle : candlesticks) {
         std::string change = candle.isUptrend() ? "UP" : "DOWN";
+        const size_t dateLength = TimeGrid::formatPeriodStart(candle.getDateTime(), candlesticks.timeframe(), date);
         
-        std::cout << std::left << std::setw(Constants::DATE_COLUMN_WIDTH) << candle.getDate()
+        std::cout << std::left << std::setw(Constants::DATE_COLUMN_WIDTH) << std::string_view(date, dateLength)
                   << "| " << std::setw(Constants::TEMP_COLUMN_WIDTH) << std::fixed << std::setprecision(2) << candle.getOpen()
                   << "| " << std::setw(Constants::TEMP_COLUMN_WIDTH) << std::fixed << std::setprecision(2) << candle.getClose()
                   << "| " << std::setw(Constants::TEMP_COLUMN_WIDTH) << std::fixed << std::setprecision(2) << candle.getHigh()
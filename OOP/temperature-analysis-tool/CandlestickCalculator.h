@@ -2,9 +2,13 @@
 #define CANDLESTICK_CALCULATOR_H
 
 #include <vector>
+#include <memory_resource>
 #include <string>
 #include "Candlestick.h"
+#include "CandlestickSeries.h"
 #include "TemperatureRecord.h"
+#include "CompactTemperatureRecord.h"
+#include "MultiCountryData.h"
 #include "Common.h"
 
 namespace CandlestickCalculator {
@@ -13,10 +17,37 @@ namespace CandlestickCalculator {
         TimeFrame timeframe
     );
     
+    /**
+     *  Same aggregation over compact records, grouped by integer period keys.
+     * Dates become text only for the labels of the resulting candles.
+     * @param threadCount Threads aggregating contiguous time slices (1 = serial,
+     *        0 = one per hardware thread); the result is identical either way.
+     */
+    std::vector<Candlestick> computeCandlesticks(
+        const std::vector<CompactTemperatureRecord>& records, 
+        TimeFrame timeframe,
+        unsigned threadCount = 1
+    );
+    std::vector<Candlestick> computeCandlesticks(
+        const std::pmr::vector<CompactTemperatureRecord>& records, 
+        TimeFrame timeframe,
+        unsigned threadCount = 1
+    );
+    
+    /**
+     *  Aggregates one country of a multi-country load straight from its
+     * columns; quantized values are decoded as they are read.
+     */
+    std::vector<Candlestick> computeCandlesticks(
+        const MultiCountryData& data,
+        const CountrySeries& series,
+        TimeFrame timeframe
+    );
+    
     // Helper functions
     std::string getGroupKey(const std::string& dateTime, TimeFrame timeframe);
     std::string formatDateLabel(const std::string& groupKey, TimeFrame timeframe);
-    void printCandlestickTable(const std::vector<Candlestick>& candlesticks);
+    void printCandlestickTable(const CandlestickSeries& candlesticks);
 }
 
 #endif
\ No newline at end of file
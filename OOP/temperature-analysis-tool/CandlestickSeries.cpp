@@ -0,0 +1,216 @@
+#include "CandlestickSeries.h"
+#include <algorithm>
+#include <iostream>
+
+//self written code start
+int32_t CandlestickSeries::Row::getDateKey() const {
+    const DateTime start = getDateTime();
+    return Candlestick::packDate(start.year, start.month, start.day);
+}
+
+Candlestick CandlestickSeries::Row::toCandlestick() const {
+    return Candlestick(getDateTime(), getOpen(), getClose(), getHigh(), getLow());
+}
+
+CandlestickSeries::Buffer::Buffer(std::pmr::memory_resource* resource)
+    : validity(resource), wordRanks(resource), opens(resource), closes(resource), highs(resource), lows(resource) {
+}
+
+size_t CandlestickSeries::Buffer::slotOf(size_t row) const {
+    // Last word whose rank does not exceed row holds the row's bit
+    const auto word = std::upper_bound(wordRanks.begin(), wordRanks.end(), row) - wordRanks.begin() - 1;
+    uint64_t bits = validity[word];
+    for (size_t skip = row - wordRanks[word]; skip > 0; --skip) {
+        bits &= bits - 1;
+    }
+    return word * BITS_PER_WORD + countTrailingZeros(bits);
+}
+
+CandlestickSeries::CandlestickSeries(std::pmr::memory_resource* resource)
+    : CandlestickSeries(TimeFrame::Daily, resource) {
+}
+
+CandlestickSeries::CandlestickSeries(TimeFrame timeframe, std::pmr::memory_resource* resource)
+    : resource_(resource), timeframe_(timeframe), firstPeriod_(0),
+      rowBegin_(0), rowEnd_(0), slotBegin_(0), slotEnd_(0) {
+}
+
+CandlestickSeries::CandlestickSeries(const std::vector<Candlestick>& candlesticks, TimeFrame timeframe,
+                                     std::pmr::memory_resource* resource)
+    : CandlestickSeries(timeframe, resource) {
+    reserve(candlesticks.size());
+    size_t rejected = 0;
+    for (const auto& candle : candlesticks) {
+        rejected += !push_back(candle);
+    }
+    if (rejected > 0) {
+        std::cerr << "Warning: " << rejected << " of " << candlesticks.size()
+                  << " candles dropped (unparseable date, or not after the previous candle's period)." << std::endl;
+    }
+}
+
+CandlestickSeries::CandlestickSeries(const CandlestickSeries& source, size_t begin, size_t end)
+    : CandlestickSeries(source.timeframe_, source.resource_) {
+    end = std::min(end, source.size());
+    begin = std::min(begin, end);
+    if (begin == end) {
+        return;
+    }
+
+    buffer_ = source.buffer_;
+    rowBegin_ = source.rowBegin_ + begin;
+    rowEnd_ = source.rowBegin_ + end;
+    slotBegin_ = source.slotBegin_ + source.slotOf(begin);
+    slotEnd_ = source.slotBegin_ + source.slotOf(end - 1) + 1;
+    firstPeriod_ = buffer_->firstPeriod + static_cast<int32_t>(slotBegin_);
+}
+
+void CandlestickSeries::reserve(size_t capacity) {
+    makeAppendable();
+    buffer_->opens.reserve(capacity);
+    buffer_->closes.reserve(capacity);
+    buffer_->highs.reserve(capacity);
+    buffer_->lows.reserve(capacity);
+}
+
+void CandlestickSeries::clear() {
+    buffer_.reset();
+    firstPeriod_ = 0;
+    rowBegin_ = rowEnd_ = 0;
+    slotBegin_ = slotEnd_ = 0;
+}
+
+bool CandlestickSeries::push_back(const Candlestick& candle) {
+    // Key 0 marks a candle whose date text did not parse; it has no period
+    if (candle.getDateKey() == 0) {
+        return false;
+    }
+    return append(TimeGrid::periodIndex(candle.getDateTime(), timeframe_),
+                  candle.getOpen(), candle.getClose(), candle.getHigh(), candle.getLow());
+}
+
+bool CandlestickSeries::push_back(const Row& row) {
+    if (empty()) {
+        timeframe_ = row.timeframe();
+    } else if (row.timeframe() != timeframe_) {
+        return false;
+    }
+    return append(row.getPeriod(), row.getOpen(), row.getClose(), row.getHigh(), row.getLow());
+}
+
+bool CandlestickSeries::append(int32_t period, double open, double close, double high, double low) {
+    if (!empty() && period - firstPeriod_ < static_cast<int64_t>(slotCount())) {
+        return false;
+    }
+    makeAppendable();
+
+    Buffer& buffer = *buffer_;
+    if (buffer.closes.empty()) {
+        buffer.firstPeriod = period;
+        firstPeriod_ = period;
+    }
+
+    const size_t slot = static_cast<size_t>(period - buffer.firstPeriod);
+    while (buffer.validity.size() <= slot / BITS_PER_WORD) {
+        // Every row so far lies in an earlier word
+        buffer.wordRanks.push_back(static_cast<uint32_t>(buffer.closes.size()));
+        buffer.validity.push_back(0);
+    }
+    buffer.validity[slot / BITS_PER_WORD] |= uint64_t{1} << (slot % BITS_PER_WORD);
+    buffer.slotCount = slot + 1;
+
+    buffer.opens.push_back(open);
+    buffer.closes.push_back(close);
+    buffer.highs.push_back(high);
+    buffer.lows.push_back(low);
+
+    rowEnd_ = buffer.closes.size();
+    slotEnd_ = buffer.slotCount;
+    return true;
+}
+
+void CandlestickSeries::makeAppendable() {
+    if (buffer_ && buffer_.use_count() == 1 && rowBegin_ == 0 && rowEnd_ == buffer_->closes.size()) {
+        return;
+    }
+
+    // Copy-on-write: the rows of this view move into a buffer of its own
+    auto owned = std::allocate_shared<Buffer>(std::pmr::polymorphic_allocator<Buffer>(resource_), resource_);
+    if (!empty()) {
+        const Column openColumn = opens(), closeColumn = closes(), highColumn = highs(), lowColumn = lows();
+        owned->firstPeriod = firstPeriod_;
+        owned->opens.assign(openColumn.begin(), openColumn.end());
+        owned->closes.assign(closeColumn.begin(), closeColumn.end());
+        owned->highs.assign(highColumn.begin(), highColumn.end());
+        owned->lows.assign(lowColumn.begin(), lowColumn.end());
+        owned->validity.reserve(wordCount(slotCount()));
+        owned->wordRanks.reserve(wordCount(slotCount()));
+        forEachSlot([&owned](size_t index, size_t slot) {
+            while (owned->validity.size() <= slot / BITS_PER_WORD) {
+                owned->wordRanks.push_back(static_cast<uint32_t>(index));
+                owned->validity.push_back(0);
+            }
+            owned->validity[slot / BITS_PER_WORD] |= uint64_t{1} << (slot % BITS_PER_WORD);
+        });
+        owned->slotCount = slotCount();
+    }
+
+    buffer_ = std::move(owned);
+    rowEnd_ = size();
+    rowBegin_ = 0;
+    slotEnd_ = slotCount();
+    slotBegin_ = 0;
+}
+
+size_t CandlestickSeries::slotOf(size_t index) const {
+    return buffer_->slotOf(rowBegin_ + index) - slotBegin_;
+}
+
+size_t CandlestickSeries::nextValidSlot(size_t from) const {
+    if (from >= slotCount()) {
+        return slotCount();
+    }
+
+    const size_t absolute = slotBegin_ + from;
+    size_t word = absolute / BITS_PER_WORD;
+    uint64_t bits = buffer_->validity[word] & (~uint64_t{0} << (absolute % BITS_PER_WORD));
+    while (bits == 0) {
+        if (++word == buffer_->validity.size()) {
+            return slotCount();
+        }
+        bits = buffer_->validity[word];
+    }
+    return std::min(word * BITS_PER_WORD + countTrailingZeros(bits), slotEnd_) - slotBegin_;
+}
+
+CandlestickSeries CandlestickSeries::select(const std::pmr::vector<uint8_t>& keep) const {
+    const size_t count = std::min(keep.size(), size());
+    size_t kept = 0;
+    for (size_t i = 0; i < count; ++i) {
+        kept += keep[i] != 0;
+    }
+
+    // A selection spans at most this series' slots, so its validity words are reserved up front too
+    CandlestickSeries selected(timeframe_, resource_);
+    selected.reserve(kept);
+    selected.buffer_->validity.reserve(wordCount(slotCount()));
+    selected.buffer_->wordRanks.reserve(wordCount(slotCount()));
+    const Column openColumn = opens(), closeColumn = closes(), highColumn = highs(), lowColumn = lows();
+    forEachSlot([&](size_t index, size_t slot) {
+        if (index < count && keep[index]) {
+            selected.append(firstPeriod_ + static_cast<int32_t>(slot), openColumn[index], closeColumn[index],
+                            highColumn[index], lowColumn[index]);
+        }
+    });
+    return selected;
+}
+
+std::vector<Candlestick> CandlestickSeries::toCandlesticks() const {
+    std::vector<Candlestick> candlesticks;
+    candlesticks.reserve(size());
+    for (const auto& row : *this) {
+        candlesticks.push_back(row.toCandlestick());
+    }
+    return candlesticks;
+}
+//self written code end
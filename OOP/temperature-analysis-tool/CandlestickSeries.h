@@ -0,0 +1,277 @@
+#ifndef CANDLESTICK_SERIES_H
+#define CANDLESTICK_SERIES_H
+
+#include <vector>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include "Candlestick.h"
+#include "DateTime.h"
+#include "Common.h"
+#include "TimeGrid.h"
+
+//self written code start
+/**
+ *  Candlesticks stored column by column (structure of arrays) on a regular
+ * time grid.
+ *
+ * Open, close, high and low each live in their own contiguous array, so a
+ * statistical pass reads only the columns it needs and its loop can be
+ * vectorised. Rows carry no date: the series records its timeframe and the
+ * grid index of its first period (see TimeGrid), plus one validity bit per
+ * period from there to the last row. A set bit means that period has a
+ * candle; clear bits are gaps (no readings, or rows removed by a filter).
+ * A row's period is found from the bitmap with count-trailing-zero scans, so
+ * kernels can place rows in time without touching date text.
+ *
+ * The columns live in a reference-counted buffer that is never modified
+ * while shared. A series is a view of a contiguous run of that buffer's rows,
+ * so copying a series or slicing rows out of it is O(1) and stages can pass
+ * data along by value. Appending to a view whose buffer is shared, or that
+ * does not reach the buffer's end, first copies the view's rows into a
+ * buffer of its own (copy-on-write).
+ *
+ * Row gives existing call sites the familiar Candlestick getters without
+ * materialising a Candlestick. Buffers are allocated from a std::pmr memory
+ * resource, so a series (and the slices and selections taken from it) can
+ * live in a per-analysis arena.
+ */
+class CandlestickSeries {
+public:
+    /**
+     *  Read-only contiguous view of one column of the series' rows.
+     */
+    class Column {
+    public:
+        Column(const double* data, size_t size) : data_(data), size_(size) {}
+
+        const double* data() const { return data_; }
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        const double* begin() const { return data_; }
+        const double* end() const { return data_ + size_; }
+        double operator[](size_t index) const { return data_[index]; }
+
+    private:
+        const double* data_;
+        size_t size_;
+    };
+
+    /**
+     *  Read-only view of one candle; valid while the series is not modified.
+     */
+    class Row {
+    public:
+        Row(const CandlestickSeries& series, size_t index, size_t slot)
+            : series_(&series), index_(index), slot_(slot) {}
+
+        /**
+         *  Grid index of the candle's period (see TimeGrid::periodIndex).
+         */
+        int32_t getPeriod() const { return series_->firstPeriod_ + static_cast<int32_t>(slot_); }
+        DateTime getDateTime() const { return TimeGrid::periodStart(getPeriod(), series_->timeframe_); }
+        int32_t getDateKey() const;
+        std::string getDate() const { return Candlestick::formatDateKey(getDateKey()); }
+        double getOpen() const { return series_->opens()[index_]; }
+        double getClose() const { return series_->closes()[index_]; }
+        double getHigh() const { return series_->highs()[index_]; }
+        double getLow() const { return series_->lows()[index_]; }
+
+        bool isUptrend() const { return getClose() >= getOpen(); }
+        double getVolatility() const { return getHigh() - getLow(); }
+        double getMeanTemperature() const { return getClose(); }
+
+        size_t index() const { return index_; }
+
+        /**
+         *  Offset of the candle's period from the series' first period.
+         */
+        size_t slot() const { return slot_; }
+        TimeFrame timeframe() const { return series_->timeframe_; }
+        Candlestick toCandlestick() const;
+
+    private:
+        const CandlestickSeries* series_;
+        size_t index_;
+        size_t slot_;
+    };
+
+    class const_iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Row;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Row;
+
+        const_iterator(const CandlestickSeries& series, size_t index, size_t slot)
+            : series_(&series), index_(index), slot_(slot) {}
+
+        Row operator*() const { return Row(*series_, index_, slot_); }
+        const_iterator& operator++() {
+            ++index_;
+            slot_ = series_->nextValidSlot(slot_ + 1);
+            return *this;
+        }
+        const_iterator operator++(int) { const_iterator previous = *this; ++*this; return previous; }
+        bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+        bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+
+    private:
+        const CandlestickSeries* series_;
+        size_t index_;
+        size_t slot_;
+    };
+
+    explicit CandlestickSeries(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    explicit CandlestickSeries(TimeFrame timeframe,
+                               std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     *  Places candles computed for timeframe on the grid. Candles must be in
+     * increasing period order, as the calculators produce them; any candle
+     * push_back refuses is dropped and counted in a warning on std::cerr.
+     */
+    CandlestickSeries(const std::vector<Candlestick>& candlesticks, TimeFrame timeframe,
+                      std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     *  View of rows [begin, end) of source; shares source's buffer.
+     */
+    CandlestickSeries(const CandlestickSeries& source, size_t begin, size_t end);
+
+    // Copies are views of the same buffer
+    CandlestickSeries(const CandlestickSeries&) = default;
+    CandlestickSeries& operator=(const CandlestickSeries&) = default;
+    CandlestickSeries(CandlestickSeries&&) = default;
+    CandlestickSeries& operator=(CandlestickSeries&&) = default;
+
+    size_t size() const { return rowEnd_ - rowBegin_; }
+    bool empty() const { return rowEnd_ == rowBegin_; }
+    void reserve(size_t capacity);
+    void clear();
+
+    /**
+     *  Appends a candle after the last row.
+     * @return false (and nothing is added) if the candle's period is not later
+     *         than the last row's, its date did not parse (date key 0), or a
+     *         row comes from another timeframe. An empty series adopts the
+     *         timeframe of the first row appended.
+     */
+    bool push_back(const Candlestick& candle);
+    bool push_back(const Row& row);
+
+    /**
+     *  Keeps the rows whose keep flag is non-zero, in order and on the same
+     * grid. The kept rows are gathered into a new buffer from this series'
+     * memory resource.
+     * @param keep One flag per row, typically computed from a single column.
+     */
+    CandlestickSeries select(const std::pmr::vector<uint8_t>& keep) const;
+
+    std::pmr::memory_resource* resource() const { return resource_; }
+
+    Row operator[](size_t index) const { return Row(*this, index, slotOf(index)); }
+    Row front() const { return Row(*this, 0, 0); }
+    Row back() const { return Row(*this, size() - 1, slotCount() - 1); }
+    const_iterator begin() const { return const_iterator(*this, 0, 0); }
+    const_iterator end() const { return const_iterator(*this, size(), slotCount()); }
+
+    // Grid
+    TimeFrame timeframe() const { return timeframe_; }
+    int32_t firstPeriod() const { return firstPeriod_; }
+
+    /**
+     *  Periods from the first row to the last, gaps included.
+     */
+    size_t slotCount() const { return slotEnd_ - slotBegin_; }
+    size_t slotOf(size_t index) const;
+
+    /**
+     *  Calls visit(index, slot) for every row in order, walking the validity
+     * bitmap a word at a time.
+     */
+    template<typename Visit>
+    void forEachSlot(Visit visit) const {
+        if (empty()) {
+            return;
+        }
+        const size_t firstWord = slotBegin_ / BITS_PER_WORD;
+        const size_t lastWord = (slotEnd_ - 1) / BITS_PER_WORD;
+        size_t index = 0;
+        for (size_t word = firstWord; word <= lastWord; ++word) {
+            uint64_t bits = buffer_->validity[word];
+            if (word == firstWord) {
+                bits &= ~uint64_t{0} << (slotBegin_ % BITS_PER_WORD);
+            }
+            if (word == lastWord && slotEnd_ % BITS_PER_WORD != 0) {
+                bits &= (uint64_t{1} << (slotEnd_ % BITS_PER_WORD)) - 1;
+            }
+            for (; bits != 0; bits &= bits - 1) {
+                visit(index++, word * BITS_PER_WORD + countTrailingZeros(bits) - slotBegin_);
+            }
+        }
+    }
+
+    // Columns, for kernels that stream a single field
+    Column opens() const { return column(&Buffer::opens); }
+    Column closes() const { return column(&Buffer::closes); }
+    Column highs() const { return column(&Buffer::highs); }
+    Column lows() const { return column(&Buffer::lows); }
+
+    std::vector<Candlestick> toCandlesticks() const;
+
+private:
+    static constexpr size_t BITS_PER_WORD = 64;
+
+    /**
+     *  Rows and validity bitmap shared by every view taken from them.
+     */
+    struct Buffer {
+        explicit Buffer(std::pmr::memory_resource* resource);
+
+        size_t slotOf(size_t row) const;
+
+        int32_t firstPeriod{0};
+        size_t slotCount{0};
+        std::pmr::vector<uint64_t> validity;
+        // Rows before each validity word, so a row's slot is one search away
+        std::pmr::vector<uint32_t> wordRanks;
+        std::pmr::vector<double> opens;
+        std::pmr::vector<double> closes;
+        std::pmr::vector<double> highs;
+        std::pmr::vector<double> lows;
+    };
+
+    static size_t countTrailingZeros(uint64_t bits) { return static_cast<size_t>(__builtin_ctzll(bits)); }
+    static constexpr size_t wordCount(size_t slots) { return (slots + BITS_PER_WORD - 1) / BITS_PER_WORD; }
+
+    Column column(std::pmr::vector<double> Buffer::*field) const {
+        return buffer_ ? Column(((*buffer_).*field).data() + rowBegin_, size()) : Column(nullptr, 0);
+    }
+
+    size_t nextValidSlot(size_t from) const;
+    bool append(int32_t period, double open, double close, double high, double low);
+
+    /**
+     *  Gives this series a buffer of its own that ends at its last row.
+     */
+    void makeAppendable();
+
+    std::pmr::memory_resource* resource_;
+    TimeFrame timeframe_;
+    std::shared_ptr<Buffer> buffer_;
+    // Grid index of the view's first slot
+    int32_t firstPeriod_;
+    // The view: rows [rowBegin_, rowEnd_) and slots [slotBegin_, slotEnd_) of the buffer
+    size_t rowBegin_;
+    size_t rowEnd_;
+    size_t slotBegin_;
+    size_t slotEnd_;
+};
+
+#endif
+//self written code end
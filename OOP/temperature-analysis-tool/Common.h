@@ -71,7 +71,13 @@ namespace Constants {
 enum class TimeFrame { 
     Daily, 
     Monthly, 
-    Yearly 
+    Yearly,
+    //self written code start
+    Weekly,     // ISO 8601 weeks, Monday to Sunday
+    Quarterly,  // Jan-Mar, Apr-Jun, Jul-Sep, Oct-Dec
+    Seasonal,   // Meteorological seasons DJF/MAM/JJA/SON; December counts to the next year's winter
+    HourOfDay   // Diurnal profile: one bucket per hour of the day over the whole range
+    //self written code end
 };
 
 enum class FilterType {
@@ -88,6 +94,10 @@ namespace Utils {
             case TimeFrame::Yearly:  return "Yearly";
             case TimeFrame::Monthly: return "Monthly";
             case TimeFrame::Daily:   return "Daily";
+            case TimeFrame::Weekly:    return "Weekly";
+            case TimeFrame::Quarterly: return "Quarterly";
+            case TimeFrame::Seasonal:  return "Seasonal";
+            case TimeFrame::HourOfDay: return "Hour-of-Day";
             default: return "Unknown";
         }
     }
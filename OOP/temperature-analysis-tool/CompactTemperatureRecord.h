@@ -0,0 +1,24 @@
+#ifndef COMPACT_TEMPERATURE_RECORD_H
+#define COMPACT_TEMPERATURE_RECORD_H
+
+#include <cstdint>
+#include "DateTime.h"
+
+//self written code start
+/**
+ *  8-byte temperature reading: the timestamp as whole hours since
+ * 1970-01-01 and the temperature as a float. Holds the same information as
+ * TemperatureRecord for hourly data without a heap-allocated date string;
+ * text is produced only when a date is displayed.
+ */
+struct CompactTemperatureRecord {
+    int32_t epochHours;
+    float temperature;
+
+    DateTime dateTime() const { return DateTime::fromEpochHours(epochHours); }
+};
+
+static_assert(sizeof(CompactTemperatureRecord) == 8, "CompactTemperatureRecord must stay 8 bytes");
+
+#endif
+//self written code end
@@ -0,0 +1,183 @@
+#include "CsvScanner.h"
+#include <atomic>
+#include <cstring>
+
+//self written code start
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && defined(__SSE2__)
+    #define CSV_SCANNER_X86 1
+    #include <immintrin.h>
+#endif
+
+namespace CsvScanner {
+
+namespace {
+    using MaskFunction = uint64_t (*)(const char*);
+
+    uint64_t scalarMask(const char* block) {
+        uint64_t mask = 0;
+        for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+            const char c = block[i];
+            if (c == '"' || c == ',' || c == '\n') {
+                mask |= uint64_t(1) << i;
+            }
+        }
+        return mask;
+    }
+
+#ifdef CSV_SCANNER_X86
+    uint64_t sse2Mask(const char* block) {
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i comma = _mm_set1_epi8(',');
+        const __m128i newline = _mm_set1_epi8('\n');
+
+        uint64_t mask = 0;
+        for (size_t i = 0; i < BLOCK_SIZE; i += 16) {
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+            const __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, quote), _mm_cmpeq_epi8(bytes, comma)),
+                                              _mm_cmpeq_epi8(bytes, newline));
+            mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(hits))) << i;
+        }
+        return mask;
+    }
+
+    __attribute__((target("avx2")))
+    uint64_t avx2Mask(const char* block) {
+        const __m256i quote = _mm256_set1_epi8('"');
+        const __m256i comma = _mm256_set1_epi8(',');
+        const __m256i newline = _mm256_set1_epi8('\n');
+
+        uint64_t mask = 0;
+        for (size_t i = 0; i < BLOCK_SIZE; i += 32) {
+            const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + i));
+            const __m256i hits = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(bytes, quote),
+                                                                 _mm256_cmpeq_epi8(bytes, comma)),
+                                                 _mm256_cmpeq_epi8(bytes, newline));
+            mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(hits))) << i;
+        }
+        return mask;
+    }
+#endif
+
+    bool isSupported(Kernel kernel) {
+        switch (kernel) {
+#ifdef CSV_SCANNER_X86
+            case Kernel::AVX2:
+                return __builtin_cpu_supports("avx2");
+            case Kernel::SSE2:
+                return true;
+#endif
+            case Kernel::Scalar:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    MaskFunction functionFor(Kernel kernel) {
+        switch (kernel) {
+#ifdef CSV_SCANNER_X86
+            case Kernel::AVX2: return avx2Mask;
+            case Kernel::SSE2: return sse2Mask;
+#endif
+            default:           return scalarMask;
+        }
+    }
+
+    Kernel bestKernel() {
+        if (isSupported(Kernel::AVX2)) return Kernel::AVX2;
+        if (isSupported(Kernel::SSE2)) return Kernel::SSE2;
+        return Kernel::Scalar;
+    }
+
+    // Chosen once on first use; setKernel() may replace it later
+    std::atomic<Kernel>& currentKernel() {
+        static std::atomic<Kernel> kernel{bestKernel()};
+        return kernel;
+    }
+
+    std::atomic<MaskFunction>& currentMask() {
+        static std::atomic<MaskFunction> mask{functionFor(currentKernel().load())};
+        return mask;
+    }
+
+    inline unsigned lowestBit(uint64_t mask) {
+        return static_cast<unsigned>(__builtin_ctzll(mask));
+    }
+
+    // Offset one past the last cell of a row that ends at rowEnd
+    uint32_t lastCellEnd(const char* data, size_t cellStart, size_t rowEnd) {
+        if (rowEnd > cellStart && data[rowEnd - 1] == '\r') --rowEnd;
+        return static_cast<uint32_t>(rowEnd);
+    }
+}
+
+Kernel activeKernel() {
+    return currentKernel().load(std::memory_order_relaxed);
+}
+
+const char* kernelName(Kernel kernel) {
+    switch (kernel) {
+        case Kernel::AVX2: return "AVX2";
+        case Kernel::SSE2: return "SSE2";
+        case Kernel::Scalar:
+        default:           return "scalar";
+    }
+}
+
+bool setKernel(Kernel kernel) {
+    if (!isSupported(kernel)) return false;
+    currentKernel().store(kernel);
+    currentMask().store(functionFor(kernel));
+    return true;
+}
+
+uint64_t structuralMask(const char* block) {
+    return currentMask().load(std::memory_order_relaxed)(block);
+}
+
+size_t scanRow(const char* data, size_t size, size_t maxCells, uint32_t* cellEnds, size_t& cellCount) {
+    const MaskFunction maskOf = currentMask().load(std::memory_order_relaxed);
+    char padded[BLOCK_SIZE];
+    bool inQuotes = false;
+    size_t cellStart = 0;
+    cellCount = 0;
+
+    for (size_t blockStart = 0; blockStart < size; blockStart += BLOCK_SIZE) {
+        uint64_t mask;
+        const size_t available = size - blockStart;
+        if (available >= BLOCK_SIZE) {
+            mask = maskOf(data + blockStart);
+        } else {
+            // Never read past the caller's range; zero bytes are not structural
+            std::memcpy(padded, data + blockStart, available);
+            std::memset(padded + available, 0, BLOCK_SIZE - available);
+            mask = maskOf(padded);
+        }
+
+        for (; mask != 0; mask &= mask - 1) {
+            const size_t pos = blockStart + lowestBit(mask);
+            const char c = data[pos];
+
+            if (c == '"') {
+                inQuotes = !inQuotes;
+            } else if (c == '\n') {
+                cellEnds[cellCount++] = lastCellEnd(data, cellStart, pos);
+                return pos;
+            } else if (!inQuotes) {
+                cellEnds[cellCount++] = static_cast<uint32_t>(pos);
+                cellStart = pos + 1;
+                if (cellCount == maxCells) {
+                    // The remaining cells are not needed, only where the row ends
+                    const void* newline = std::memchr(data + cellStart, '\n', size - cellStart);
+                    return newline ? static_cast<size_t>(static_cast<const char*>(newline) - data) : size;
+                }
+            }
+        }
+    }
+
+    cellEnds[cellCount++] = lastCellEnd(data, cellStart, size);
+    return size;
+}
+
+} // namespace CsvScanner
+//self written code end
@@ -0,0 +1,49 @@
+#ifndef CSV_SCANNER_H
+#define CSV_SCANNER_H
+
+#include <cstddef>
+#include <cstdint>
+
+//self written code start
+/**
+ *  Vectorised scanning of CSV text for structural characters.
+ *
+ * The kernel classifies 64 bytes at a time and returns a bitmask of the
+ * quotes, commas and newlines among them. SSE2 and AVX2 versions are built
+ * on x86 and the best one the CPU supports is picked on first use; every
+ * other platform uses the scalar loop.
+ */
+namespace CsvScanner {
+    constexpr size_t BLOCK_SIZE = 64;
+
+    enum class Kernel { Scalar, SSE2, AVX2 };
+
+    Kernel activeKernel();
+    const char* kernelName(Kernel kernel);
+
+    /**
+     *  Overrides the runtime choice, e.g. to compare kernels.
+     * @return false (and keeps the current kernel) if the CPU cannot run it.
+     */
+    bool setKernel(Kernel kernel);
+
+    /**
+     *  Bit i is set if block[i] is '"', ',' or '\n'. block must have
+     * BLOCK_SIZE readable bytes.
+     */
+    uint64_t structuralMask(const char* block);
+
+    /**
+     *  Locates the quote-aware cells of the row starting at data. Commas inside
+     * quotes do not end a cell; a newline always ends the row. cellEnds[i]
+     * receives the offset one past cell i (a trailing '\r' is excluded from the
+     * last cell of the row), so cell i starts at 0 or cellEnds[i - 1] + 1.
+     * Scanning stops after maxCells cells (maxCells must be at least 1).
+     * @param cellCount Receives the number of cells written to cellEnds.
+     * @return The offset of the row's '\n', or size if the row is unterminated.
+     */
+    size_t scanRow(const char* data, size_t size, size_t maxCells, uint32_t* cellEnds, size_t& cellCount);
+}
+
+#endif
+//self written code end
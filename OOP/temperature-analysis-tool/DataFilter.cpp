@@ -12,7 +12,7 @@ namespace DataFilter {
 
 namespace {
     // Helper function for input validation
-    bool validateFilterInput(const std::vector<Candlestick>& data, const std::string& filterType) {
+    bool validateFilterInput(const CandlestickSeries& data, const std::string& filterType) {
         if (data.empty()) {
             std::cout << "Warning: No data provided for " << filterType << " filtering.\n";
             return false;
@@ -21,7 +21,7 @@ namespace {
     }
     
     // Helper function to handle empty results and print stats
-    void handleFilterResults(const std::vector<Candlestick>& filtered, size_t originalSize, 
+    void handleFilterResults(const CandlestickSeries& filtered, size_t originalSize, 
                             const std::string& filterName, const std::string& warningMessage = "") {
         printFilterStats(originalSize, filtered.size(), filterName);
         
@@ -30,27 +30,26 @@ namespace {
         }
     }
     
-    //Applies a filter based on a predicate function
-    // and handles the results, including printing stats and warnings.
+    //Applies a filter based on a predicate over row indices. The predicate
+    // reads only the columns it needs, so the keep mask is built in one
+    // contiguous pass before the kept rows are gathered.
     template<typename PredicateFunc>
-    std::vector<Candlestick> applyFilter(const std::vector<Candlestick>& data, 
-                                        const std::string& filterType,
-                                        const std::string& filterName,
-                                        const std::string& warningMessage,
-                                        PredicateFunc predicate) {
-        std::vector<Candlestick> filtered;
-        
+    CandlestickSeries applyFilter(const CandlestickSeries& data, 
+                                  const std::string& filterType,
+                                  const std::string& filterName,
+                                  const std::string& warningMessage,
+                                  PredicateFunc predicate) {
         if (!validateFilterInput(data, filterType)) {
-            return filtered;
+            return CandlestickSeries();
         }
         
         const size_t originalSize = data.size();
         
-        // Reserve space to avoid reallocations
-        filtered.reserve(data.size());
-        
-        // Use copy_if for better performance
-        std::copy_if(data.begin(), data.end(), std::back_inserter(filtered), predicate);
+        std::pmr::vector<uint8_t> keep(originalSize, data.resource());
+        for (size_t i = 0; i < originalSize; ++i) {
+            keep[i] = predicate(i) ? 1 : 0;
+        }
+        CandlestickSeries filtered = data.select(keep);
         
         handleFilterResults(filtered, originalSize, filterName, warningMessage);
         
@@ -59,9 +58,9 @@ namespace {
 }
 
 //self written code start
-std::vector<Candlestick> filterByDateRange(const std::vector<Candlestick>& data, 
+CandlestickSeries filterByDateRange(const CandlestickSeries& data, 
                                           const std::string& startDate, const std::string& endDate) {
-    std::vector<Candlestick> filtered;
+    CandlestickSeries filtered;
     
     if (!validateFilterInput(data, "date range")) {
         return filtered;
@@ -72,23 +71,47 @@ std::vector<Candlestick> filterByDateRange(const std::vector<Candlestick>& data,
         return filtered;
     }
     
-    if (startDate > endDate) {
+    // Dates are packed once; the predicate then compares two integers per candle
+    int32_t startKey = 0;
+    int32_t endKey = 0;
+    if (!Candlestick::parseDateKey(startDate, startKey) || !Candlestick::parseDateKey(endDate, endKey)) {
+        std::cout << "Warning: Invalid date range provided.\n";
+        return filtered;
+    }
+    
+    if (startKey > endKey) {
         std::cout << "Warning: Start date (" << startDate << ") is after end date (" << endDate << ").\n";
         return filtered;
     }
     
+    // Rows are in period order, so their date keys are sorted and the kept
+    // rows form one contiguous run; two binary searches find its bounds.
+    auto firstRowWhere = [&data](auto reached) {
+        size_t low = 0, high = data.size();
+        while (low < high) {
+            const size_t middle = low + (high - low) / 2;
+            if (reached(data[middle].getDateKey())) {
+                high = middle;
+            } else {
+                low = middle + 1;
+            }
+        }
+        return low;
+    };
+    const size_t firstRow = firstRowWhere([startKey](int32_t key) { return key >= startKey; });
+    const size_t endRow = firstRowWhere([endKey](int32_t key) { return key > endKey; });
+    
     // Use the template helper function
     return applyFilter(data, "date range", "Date range filter", 
                       "No data found in the specified date range.",
-                      [&startDate, &endDate](const Candlestick& candlestick) {
-                          const std::string& candleDate = candlestick.getDate();
-                          return candleDate >= startDate && candleDate <= endDate;
+                      [firstRow, endRow](size_t i) {
+                          return i >= firstRow && i < endRow;
                       });
 }
 
-std::vector<Candlestick> filterByTemperatureRange(const std::vector<Candlestick>& data, 
+CandlestickSeries filterByTemperatureRange(const CandlestickSeries& data, 
                                                  double minTemp, double maxTemp) {
-    std::vector<Candlestick> filtered;
+    CandlestickSeries filtered;
     
     if (!validateFilterInput(data, "temperature range")) {
         return filtered;
@@ -106,13 +129,12 @@ std::vector<Candlestick> filterByTemperatureRange(const std::vector<Candlestick>
     // Use the template helper function
     return applyFilter(data, "temperature range", "Temperature filter",
                       "No data found in the specified temperature range.",
-                      [minTemp, maxTemp](const Candlestick& candlestick) {
-                          double avgTemp = candlestick.getMeanTemperature();
-                          return avgTemp >= minTemp && avgTemp <= maxTemp;
+                      [means = data.closes().data(), minTemp, maxTemp](size_t i) {
+                          return means[i] >= minTemp && means[i] <= maxTemp;
                       });
 }
 
-std::vector<Candlestick> filterByTrend(const std::vector<Candlestick>& data, bool uptrend) {
+CandlestickSeries filterByTrend(const CandlestickSeries& data, bool uptrend) {
     std::cout << "Trend filter applied: " << (uptrend ? "Upward" : "Downward") << " trends only\n";
     
     const std::string warningMessage = "No " + std::string(uptrend ? "upward" : "downward") + 
@@ -120,13 +142,13 @@ std::vector<Candlestick> filterByTrend(const std::vector<Candlestick>& data, boo
     
     // Use the template helper function
     return applyFilter(data, "trend", "Trend filter", warningMessage,
-                      [uptrend](const Candlestick& candlestick) {
-                          return candlestick.isUptrend() == uptrend;
+                      [opens = data.opens().data(), closes = data.closes().data(), uptrend](size_t i) {
+                          return (closes[i] >= opens[i]) == uptrend;
                       });
 }
 
-std::vector<Candlestick> filterByVolatility(const std::vector<Candlestick>& data, double minVolatility) {
-    std::vector<Candlestick> filtered;
+CandlestickSeries filterByVolatility(const CandlestickSeries& data, double minVolatility) {
+    CandlestickSeries filtered;
     
     if (!validateFilterInput(data, "volatility")) {
         return filtered;
@@ -145,8 +167,8 @@ std::vector<Candlestick> filterByVolatility(const std::vector<Candlestick>& data
     
     // Use the template helper function
     return applyFilter(data, "volatility", "Volatility filter", warningMessage,
-                      [minVolatility](const Candlestick& candlestick) {
-                          return candlestick.getVolatility() >= minVolatility;
+                      [highs = data.highs().data(), lows = data.lows().data(), minVolatility](size_t i) {
+                          return highs[i] - lows[i] >= minVolatility;
                       });
 }
 
@@ -3,28 +3,28 @@
 
 #include <vector>
 #include <string>
-#include "Candlestick.h"
+#include "CandlestickSeries.h"
 
 namespace DataFilter {
-    std::vector<Candlestick> filterByDateRange(
-        const std::vector<Candlestick>& data, 
+    CandlestickSeries filterByDateRange(
+        const CandlestickSeries& data, 
         const std::string& startDate, 
         const std::string& endDate
     );
     
-    std::vector<Candlestick> filterByTemperatureRange(
-        const std::vector<Candlestick>& data, 
+    CandlestickSeries filterByTemperatureRange(
+        const CandlestickSeries& data, 
         double minTemp, 
         double maxTemp
     );
     
-    std::vector<Candlestick> filterByTrend(
-        const std::vector<Candlestick>& data, 
+    CandlestickSeries filterByTrend(
+        const CandlestickSeries& data, 
         bool uptrend
     );
     
-    std::vector<Candlestick> filterByVolatility(
-        const std::vector<Candlestick>& data, 
+    CandlestickSeries filterByVolatility(
+        const CandlestickSeries& data, 
         double minVolatility
     );
     
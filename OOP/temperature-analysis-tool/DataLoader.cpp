@@ -1,8 +1,24 @@
 #include "DataLoader.h"
+#include "MappedFile.h"
+#include "CsvScanner.h"
+#include "TemperatureCache.h"
+#include "DateTime.h"
+#include "YearIndex.h"
+#include "GzipReader.h"
 #include "Common.h"
+#include "DatasetCatalog.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <string_view>
+#include <charconv>
+#include <cmath>
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <functional>
+#include <limits>
+#include <utility>
 
 /*self written code start (code built with reference to : 
  https://github.com/KC1922/StockMarketDisplay-CPP/tree/main/StockProjectCPP
@@ -12,163 +28,1259 @@
 */
 namespace DataLoader {
 
-std::vector<TemperatureRecord> loadCSV(const std::string& filename, const std::string& countryCode, 
-                                       int startYear, int endYear) {
-    std::vector<TemperatureRecord> data;
-    std::ifstream file(filename);
-    
-    if (!file.is_open()) {
-        std::cerr << "Error: Could not open file '" << filename << "'" << std::endl;
-        std::cerr << "Please ensure the file exists in the same directory as the executable." << std::endl;
-        return data;
+namespace {
+    // Characters stripped from both ends of every cell
+    constexpr std::string_view TRIM_CHARS = " \t\"";
+
+    std::string_view trimField(std::string_view field) {
+        const size_t first = field.find_first_not_of(TRIM_CHARS);
+        if (first == std::string_view::npos) {
+            return std::string_view();
+        }
+        const size_t last = field.find_last_not_of(TRIM_CHARS);
+        return field.substr(first, last - first + 1);
     }
-    
-    std::string header;
-    if (!std::getline(file, header)) {
-        std::cerr << "Error: Could not read header from file." << std::endl;
-        return data;
+
+    // Line endings may be CRLF; the '\r' is not part of the last cell
+    std::string_view stripCarriageReturn(std::string_view line) {
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        return line;
     }
-    
-    // ENHANCED: More robust column name matching
-    std::string targetColumn = countryCode + "_temperature";
-    int countryColumnIndex = -1;
-    int currentIndex = 0;
-    
-    std::stringstream headerStream(header);
-    std::string column;
-    
-    while (std::getline(headerStream, column, ',')) {
-        // Remove quotes if present and trim whitespace
-        column.erase(0, column.find_first_not_of(" \t\""));
-        column.erase(column.find_last_not_of(" \t\"") + 1);
-        
-        if (column == targetColumn) {
-            countryColumnIndex = currentIndex;
-            break;
+
+    /**
+     *  Recognises the dataset's spellings of a missing value: empty, "-", "NA",
+     * "N/A", "nan", "NaN", "null" and "NULL". Dispatches once on the length so a
+     * numeric cell is rejected after at most one character compare.
+     */
+    bool isMissingValue(std::string_view value) {
+        switch (value.size()) {
+            case 0:
+                return true;
+            case 1:
+                return value[0] == '-';
+            case 2:
+                return value[0] == 'N' && value[1] == 'A';
+            case 3:
+                if (value[0] == 'N') return value[1] == '/' ? value[2] == 'A' : value[1] == 'a' && value[2] == 'N';
+                return value[0] == 'n' && value[1] == 'a' && value[2] == 'n';
+            case 4:
+                return value == "null" || value == "NULL";
+            default:
+                return false;
         }
-        currentIndex++;
     }
-    
-    if (countryColumnIndex == -1) {
+
+    void reportMissingCountry(const DatasetCatalog& catalog, const std::string& countryCode) {
         std::cerr << "Error: Country '" << countryCode << "' not found in CSV." << std::endl;
-        std::cerr << "Looking for column: '" << targetColumn << "'" << std::endl;
+        std::cerr << "Looking for column: '" << countryCode << DatasetCatalog::COLUMN_SUFFIX << "'" << std::endl;
         
         // ENHANCED: Show available country columns to help user
         std::cerr << "Available country columns: ";
-        std::stringstream tempHeaderStream(header);
-        std::string tempColumn;
-        bool foundCountryColumns = false;
-        while (std::getline(tempHeaderStream, tempColumn, ',')) {
-            tempColumn.erase(0, tempColumn.find_first_not_of(" \t\""));
-            tempColumn.erase(tempColumn.find_last_not_of(" \t\"") + 1);
-            if (tempColumn.length() == 2 || tempColumn.find("_temperature") != std::string::npos) {
-                if (foundCountryColumns) std::cerr << ", ";
-                std::cerr << tempColumn;
-                foundCountryColumns = true;
-            }
+        for (size_t id = 0; id < catalog.countryCount(); ++id) {
+            if (id > 0) std::cerr << ", ";
+            std::cerr << catalog.countryCodes()[id] << DatasetCatalog::COLUMN_SUFFIX;
         }
         std::cerr << std::endl;
-        return data;
     }
+
+    /**
+     *  Looks the country's column up in the file's catalog.
+     * @return The column index, or -1 (after reporting it) if the file has no such country.
+     */
+    int resolveCountryColumn(const std::string& filename, std::string_view header, const std::string& countryCode) {
+        const auto catalog = DatasetCatalog::forHeader(filename, header);
+        const int columnIndex = catalog->columnIndex(countryCode);
+        if (columnIndex == -1) {
+            reportMissingCountry(*catalog, countryCode);
+        }
+        return columnIndex;
+    }
+
+    void printLoadSummary(int validRecords, int skippedRecords) {
+        // ENHANCED: Provide summary of data loading
+        std::cout << "Data loading summary:" << std::endl;
+        std::cout << "  Valid records loaded: " << validRecords << std::endl;
+        if (skippedRecords > 0) {
+            std::cout << "  Records skipped: " << skippedRecords << std::endl;
+        }
+    }
+
+    /**
+     *  The leading cells of one row of a mapped file, as located by CsvScanner.
+     * Cells are raw views (quotes included) into the source buffer.
+     */
+    struct RowCells {
+        std::string_view line;      // Without its line ending
+        std::vector<uint32_t> ends; // Capacity = the most cells scanned per row
+        size_t count{0};
+        
+        explicit RowCells(size_t maxCells) : ends(std::max<size_t>(1, maxCells)) {}
+        
+        std::string_view cell(size_t index) const {
+            const size_t start = index == 0 ? 0 : ends[index - 1] + 1;
+            return line.substr(start, ends[index] - start);
+        }
+    };
     
-    std::string line;
-    int lineNumber = 1;
-    int validRecords = 0;
-    int skippedRecords = 0;
-    
-    while (std::getline(file, line)) {
-        lineNumber++;
+    /**
+     *  Scans the row starting at lineStart up to row.ends.size() cells and
+     * advances lineStart to the following line.
+     */
+    void scanNextRow(std::string_view contents, size_t& lineStart, RowCells& row) {
+        const size_t lineEnd = CsvScanner::scanRow(contents.data() + lineStart, contents.size() - lineStart,
+                                                   row.ends.size(), row.ends.data(), row.count);
+        row.line = stripCarriageReturn(contents.substr(lineStart, lineEnd));
+        lineStart += lineEnd + 1;
+    }
+
+    /**
+     *  Produces the cleaned value of a raw cell, matching the stream parser:
+     * every quote character is dropped and surrounding whitespace is trimmed.
+     * Cells without embedded quotes are returned as views into the source buffer;
+     * the rare cell with interior quotes is rebuilt in scratch.
+     */
+    std::string_view cleanCell(std::string_view rawCell, std::string& scratch) {
+        std::string_view trimmed = trimField(rawCell);
+        if (trimmed.find('"') == std::string_view::npos) {
+            return trimmed;
+        }
         
-        if (line.empty()) continue;
+        scratch.clear();
+        for (char c : trimmed) {
+            if (c != '"') scratch += c;
+        }
+        return trimField(scratch);
+    }
+
+    /**
+     *  Parses a temperature cell without throwing or copying, with the acceptance
+     * rules of std::stod on a trimmed cell: the leading number prefix is used and
+     * out-of-range values are rejected.
+     */
+    bool parseTemperature(std::string_view text, double& temperature) {
+        const char* first = text.data();
+        const char* last = first + text.size();
         
-        std::vector<std::string> columns;
-        std::stringstream lineStream(line);
-        std::string cell;
+        // from_chars has no explicit '+' sign, which stod accepts
+        if (last - first > 1 && first[0] == '+' && first[1] != '-' && first[1] != '+') {
+            ++first;
+        }
+        return std::from_chars(first, last, temperature).ec == std::errc();
+    }
+
+    enum class CellStatus { Valid, Missing, Invalid, OutOfRange };
+
+    /**
+     *  Reads the year of a cleaned date cell. Well-formed timestamps are decoded
+     * by DateTime; anything else falls back to the number in its first four
+     * characters, as the loader has always accepted.
+     * @return false if the date is too short or does not start with a number.
+     */
+    bool parseRowYear(std::string_view dateStr, int& year) {
+        DateTime dateTime;
+        char separator;
+        size_t consumed;
+        if (DateTime::parse(dateStr, dateTime, separator, consumed)) {
+            year = dateTime.year;
+            return true;
+        }
+        
+        if (dateStr.length() < 4) {
+            return false;
+        }
+        const auto result = std::from_chars(dateStr.data(), dateStr.data() + 4, year);
+        return result.ec == std::errc();
+    }
+
+    /**
+     *  Applies the missing-value, parsing and sanity-check rules to one raw
+     * temperature cell. OutOfRange values are skipped like Invalid ones but
+     * the caller is expected to report them.
+     */
+    CellStatus readTemperatureCell(std::string_view rawCell, std::string& scratch, double& temperature) {
+        const std::string_view tempStr = cleanCell(rawCell, scratch);
+        
+        if (isMissingValue(tempStr)) {
+            return CellStatus::Missing;
+        }
         
-        // ENHANCED: Better CSV parsing to handle quoted values
-        bool inQuotes = false;
-        std::string currentCell;
+        if (!parseTemperature(tempStr, temperature)) {
+            return CellStatus::Invalid;
+        }
+        
+        if (temperature < -Constants::TEMP_RANGE_SANITY_CHECK || temperature > Constants::TEMP_RANGE_SANITY_CHECK) {
+            return CellStatus::OutOfRange;
+        }
         
-        for (char c : line) {
-            if (c == '"') {
-                inQuotes = !inQuotes;
-            } else if (c == ',' && !inQuotes) {
-                columns.push_back(currentCell);
-                currentCell.clear();
-            } else {
-                currentCell += c;
+        return CellStatus::Valid;
+    }
+
+    void reportUnusualTemperature(double temperature, int lineNumber) {
+        std::cerr << "Warning: Unusual temperature value " << temperature 
+                  << "°C on line " << lineNumber << ". Skipping." << std::endl;
+    }
+
+    std::vector<TemperatureRecord> loadStream(const std::string& filename, const std::string& countryCode, 
+                                              int startYear, int endYear) {
+        std::vector<TemperatureRecord> data;
+        std::ifstream file(filename);
+        
+        if (!file.is_open()) {
+            std::cerr << "Error: Could not open file '" << filename << "'" << std::endl;
+            std::cerr << "Please ensure the file exists in the same directory as the executable." << std::endl;
+            return data;
+        }
+        
+        std::string header;
+        if (!std::getline(file, header)) {
+            std::cerr << "Error: Could not read header from file." << std::endl;
+            return data;
+        }
+        
+        const int countryColumnIndex = resolveCountryColumn(filename, stripCarriageReturn(header), countryCode);
+        if (countryColumnIndex == -1) {
+            return data;
+        }
+        
+        std::string line;
+        int lineNumber = 1;
+        int validRecords = 0;
+        int skippedRecords = 0;
+        std::string tempScratch;
+        
+        while (std::getline(file, line)) {
+            lineNumber++;
+            
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            if (line.empty()) continue;
+            
+            std::vector<std::string> columns;
+            
+            // ENHANCED: Better CSV parsing to handle quoted values
+            bool inQuotes = false;
+            std::string currentCell;
+            
+            for (char c : line) {
+                if (c == '"') {
+                    inQuotes = !inQuotes;
+                } else if (c == ',' && !inQuotes) {
+                    columns.push_back(currentCell);
+                    currentCell.clear();
+                } else {
+                    currentCell += c;
+                }
+            }
+            columns.push_back(currentCell); // Add the last cell
+            
+            if (columns.size() <= static_cast<size_t>(countryColumnIndex)) {
+                skippedRecords++;
+                continue;
+            }
+            
+            std::string dateStr = columns[0];
+            dateStr.erase(0, dateStr.find_first_not_of(" \t\""));
+            dateStr.erase(dateStr.find_last_not_of(" \t\"") + 1);
+            
+            if (dateStr.length() < 4) {
+                skippedRecords++;
+                continue;
+            }
+            
+            int year;
+            if (!parseRowYear(dateStr, year)) {
+                skippedRecords++;
+                continue;
             }
+            
+            if (year < startYear || year > endYear) continue;
+            
+            // ENHANCED: Missing values, unparsable numbers and the sanity range, without exceptions
+            double temperature;
+            const CellStatus status = readTemperatureCell(columns[countryColumnIndex], tempScratch, temperature);
+            if (status == CellStatus::Missing) continue;
+            if (status != CellStatus::Valid) {
+                if (status == CellStatus::OutOfRange) reportUnusualTemperature(temperature, lineNumber);
+                skippedRecords++;
+                continue;
+            }
+            
+            data.push_back(TemperatureRecord(dateStr, temperature));
+            validRecords++;
         }
-        columns.push_back(currentCell); // Add the last cell
         
-        if (columns.size() <= static_cast<size_t>(countryColumnIndex)) {
-            skippedRecords++;
-            continue;
+        file.close();
+        
+        printLoadSummary(validRecords, skippedRecords);
+        return data;
+    }
+
+    /**
+     *  Maps the file and splits off its header line.
+     * @return false (after reporting the error) if the file or header cannot be read.
+     */
+    bool openMappedCSV(const std::string& filename, const MappedFile& file,
+                       std::string_view& header, size_t& bodyStart) {
+        if (!file.isOpen()) {
+            std::cerr << "Error: Could not open file '" << filename << "'" << std::endl;
+            std::cerr << "Please ensure the file exists in the same directory as the executable." << std::endl;
+            return false;
         }
         
-        std::string dateStr = columns[0];
-        dateStr.erase(0, dateStr.find_first_not_of(" \t\""));
-        dateStr.erase(dateStr.find_last_not_of(" \t\"") + 1);
+        const std::string_view contents = file.view();
+        if (contents.empty()) {
+            std::cerr << "Error: Could not read header from file." << std::endl;
+            return false;
+        }
         
-        if (dateStr.length() < 4) {
-            skippedRecords++;
-            continue;
+        size_t headerEnd = contents.find('\n');
+        if (headerEnd == std::string_view::npos) headerEnd = contents.size();
+        header = stripCarriageReturn(contents.substr(0, headerEnd));
+        bodyStart = headerEnd + 1;
+        return true;
+    }
+
+    /**
+     *  Records and counters produced by parsing one contiguous block of lines.
+     * Warnings keep the line number relative to the block so that blocks parsed
+     * in parallel can be reported in file order once their offsets are known.
+     * Record is TemperatureRecord or CompactTemperatureRecord.
+     */
+    template <typename Record>
+    struct ChunkResult {
+        std::vector<Record> records;
+        std::vector<std::pair<int, double>> unusualValues;
+        int validRecords{0};
+        int skippedRecords{0};
+        int lineCount{0};
+    };
+
+    // Materialise one accepted row; false if the row cannot be represented
+    bool appendRecord(std::vector<TemperatureRecord>& records, std::string_view dateStr, double temperature) {
+        records.emplace_back(std::string(dateStr), temperature);
+        return true;
+    }
+
+    template <typename Allocator>
+    bool appendRecord(std::vector<CompactTemperatureRecord, Allocator>& records, std::string_view dateStr, double temperature) {
+        DateTime dateTime;
+        char separator;
+        size_t consumed;
+        if (!DateTime::parse(dateStr, dateTime, separator, consumed)) {
+            return false;
+        }
+        records.push_back({dateTime.toEpochHours(), static_cast<float>(temperature)});
+        return true;
+    }
+
+    /**
+     *  Parses the lines in [chunkStart, chunkEnd) of the mapped file, stopping
+     * early once result holds maxRecords records. Each row is tokenised only up
+     * to the country column and only the date and temperature of rows that are
+     * kept are materialised.
+     * @return The offset of the first line not parsed (chunkEnd when done).
+     */
+    template <typename Record>
+    size_t parseLines(std::string_view contents, size_t chunkStart, size_t chunkEnd, int countryColumnIndex,
+                      int startYear, int endYear, size_t maxRecords, ChunkResult<Record>& result) {
+        const std::string_view chunk = contents.substr(0, chunkEnd);
+        const size_t countryColumn = static_cast<size_t>(countryColumnIndex);
+        RowCells row(countryColumn + 1); // Everything after the country column is never touched
+        std::string dateScratch;
+        std::string tempScratch;
+        size_t lineStart = chunkStart;
+        
+        while (lineStart < chunk.size() && result.records.size() < maxRecords) {
+            scanNextRow(chunk, lineStart, row);
+            result.lineCount++;
+            
+            if (row.line.empty()) continue;
+            
+            if (row.count <= countryColumn) {
+                result.skippedRecords++;
+                continue;
+            }
+            
+            const std::string_view rawTemp = row.cell(countryColumn);
+            const std::string_view dateStr = cleanCell(row.cell(0), dateScratch);
+            int year;
+            if (!parseRowYear(dateStr, year)) {
+                result.skippedRecords++;
+                continue;
+            }
+            
+            if (year < startYear || year > endYear) continue;
+            
+            double temperature;
+            const CellStatus status = readTemperatureCell(rawTemp, tempScratch, temperature);
+            if (status == CellStatus::Missing) continue;
+            if (status != CellStatus::Valid) {
+                if (status == CellStatus::OutOfRange) {
+                    result.unusualValues.emplace_back(result.lineCount, temperature);
+                }
+                result.skippedRecords++;
+                continue;
+            }
+            
+            if (!appendRecord(result.records, dateStr, temperature)) {
+                result.skippedRecords++;
+                continue;
+            }
+            result.validRecords++;
+        }
+        return std::min(lineStart, chunk.size());
+    }
+
+    template <typename Record>
+    void parseChunk(std::string_view contents, size_t chunkStart, size_t chunkEnd,
+                    int countryColumnIndex, int startYear, int endYear, ChunkResult<Record>& result) {
+        parseLines(contents, chunkStart, chunkEnd, countryColumnIndex, startYear, endYear,
+                   std::numeric_limits<size_t>::max(), result);
+    }
+
+    /**
+     *  Receives each completed batch of records; the batch is cleared afterwards.
+     */
+    using RecordSink = std::function<void(std::vector<TemperatureRecord>&)>;
+
+    /**
+     *  Sequential parser that hands records to a sink in batches of at most
+     * batchCapacity records instead of collecting them all. Ranges passed to
+     * parse() must hold complete lines and follow each other in file order;
+     * warnings are reported as they are found.
+     */
+    class BatchParser {
+    public:
+        BatchParser(int startYear, int endYear, size_t batchCapacity, RecordSink sink)
+            : startYear_(startYear), endYear_(endYear), batchCapacity_(std::max<size_t>(1, batchCapacity)),
+              sink_(std::move(sink)) {
+            if (batchCapacity_ != std::numeric_limits<size_t>::max()) {
+                batch_.records.reserve(batchCapacity_);
+            }
         }
         
-        std::string yearStr = dateStr.substr(0, 4);
-        int year;
+        /**
+         *  Selects the column to read; firstLine is the file line number of the next line parsed.
+         */
+        void setColumn(int countryColumnIndex, int firstLine) {
+            countryColumnIndex_ = countryColumnIndex;
+            lineOffset_ = firstLine - 1 - batch_.lineCount;
+        }
         
-        try {
-            year = std::stoi(yearStr);
-        } catch (const std::exception& e) {
-            skippedRecords++;
-            continue;
+        void parse(std::string_view contents, size_t begin, size_t end) {
+            while (begin < end) {
+                begin = parseLines(contents, begin, end, countryColumnIndex_, startYear_, endYear_,
+                                   batchCapacity_, batch_);
+                for (const auto& [line, temperature] : batch_.unusualValues) {
+                    reportUnusualTemperature(temperature, lineOffset_ + line);
+                }
+                batch_.unusualValues.clear();
+                if (batch_.records.size() >= batchCapacity_) emit();
+            }
         }
         
-        if (year < startYear || year > endYear) continue;
+        void finish() {
+            if (!batch_.records.empty()) emit();
+        }
         
-        std::string tempStr = columns[countryColumnIndex];
-        tempStr.erase(0, tempStr.find_first_not_of(" \t\""));
-        tempStr.erase(tempStr.find_last_not_of(" \t\"") + 1);
+        int validRecords() const { return batch_.validRecords; }
+        int skippedRecords() const { return batch_.skippedRecords; }
+        size_t batchCount() const { return batchCount_; }
+        size_t batchCapacity() const { return batchCapacity_; }
+        size_t peakBatchBytes() const { return peakBatchBytes_; }
         
-        // ENHANCED: More comprehensive handling of missing values
-        if (tempStr.empty() || tempStr == "NA" || tempStr == "N/A" || 
-            tempStr == "-" || tempStr == "null" || tempStr == "NULL" ||
-            tempStr == "nan" || tempStr == "NaN") {
-            continue;
+    private:
+        void emit() {
+            // Dates longer than the small-string buffer live on the heap
+            const size_t inlineCapacity = std::string().capacity();
+            size_t bytes = batch_.records.capacity() * sizeof(TemperatureRecord);
+            for (const auto& record : batch_.records) {
+                if (record.date.capacity() > inlineCapacity) bytes += record.date.capacity() + 1;
+            }
+            peakBatchBytes_ = std::max(peakBatchBytes_, bytes);
+            
+            sink_(batch_.records);
+            batch_.records.clear();
+            batchCount_++;
+        }
+        
+        int startYear_;
+        int endYear_;
+        size_t batchCapacity_;
+        RecordSink sink_;
+        ChunkResult<TemperatureRecord> batch_;
+        int countryColumnIndex_{0};
+        int lineOffset_{0};
+        size_t batchCount_{0};
+        size_t peakBatchBytes_{0};
+    };
+
+    /**
+     *  Splits [rangeBegin, rangeEnd) into at most threadCount blocks that each end
+     * on a line boundary. Small ranges are kept in fewer blocks so that thread
+     * start-up never dominates the parse.
+     */
+    std::vector<size_t> splitAtLineBoundaries(std::string_view contents, size_t rangeBegin, size_t rangeEnd,
+                                              unsigned threadCount) {
+        constexpr size_t MIN_CHUNK_BYTES = 1 << 20;
+        
+        rangeEnd = std::max(rangeEnd, rangeBegin);
+        const size_t rangeSize = rangeEnd - rangeBegin;
+        const size_t maxChunks = std::max<size_t>(1, rangeSize / MIN_CHUNK_BYTES);
+        const size_t chunkCount = std::min<size_t>(std::max(1u, threadCount), maxChunks);
+        
+        std::vector<size_t> boundaries;
+        boundaries.push_back(rangeBegin);
+        
+        for (size_t i = 1; i < chunkCount; ++i) {
+            size_t target = std::max(rangeBegin + (rangeSize * i) / chunkCount, boundaries.back());
+            const size_t newline = contents.find('\n', target);
+            if (newline == std::string_view::npos || newline + 1 >= rangeEnd) break;
+            boundaries.push_back(newline + 1);
+        }
+        boundaries.push_back(rangeEnd);
+        return boundaries;
+    }
+
+    /**
+     *  Scans the date column once and records where each calendar month starts.
+     * Rows whose date has no readable year are ignored (they can never match a
+     * year window); a readable year with an unreadable month, or months going
+     * backwards, means the file cannot be indexed.
+     */
+    bool buildYearIndex(std::string_view contents, size_t bodyStart, YearIndex& index) {
+        std::vector<YearIndex::Entry> entries;
+        RowCells row(1);
+        std::string dateScratch;
+        size_t lineStart = bodyStart;
+        int lineNumber = 1;
+        int previousKey = -1;
+        
+        while (lineStart < contents.size()) {
+            const size_t offset = lineStart;
+            scanNextRow(contents, lineStart, row);
+            lineNumber++;
+            
+            if (row.line.empty()) continue;
+            
+            const std::string_view dateStr = cleanCell(row.cell(0), dateScratch);
+            int year;
+            if (!parseRowYear(dateStr, year)) continue;
+            
+            int month = 0;
+            if (dateStr.size() < 7 || dateStr[4] != '-' ||
+                std::from_chars(dateStr.data() + 5, dateStr.data() + 7, month).ec != std::errc() ||
+                month < 1 || month > 12) {
+                return false;
+            }
+            
+            const int key = year * 12 + (month - 1);
+            if (key < previousKey) return false;
+            if (key > previousKey) {
+                YearIndex::Entry entry{};
+                entry.year = static_cast<int16_t>(year);
+                entry.month = static_cast<uint8_t>(month);
+                entry.lineNumber = static_cast<uint32_t>(lineNumber);
+                entry.offset = offset;
+                entries.push_back(entry);
+                previousKey = key;
+            }
+        }
+        
+        index = YearIndex(std::move(entries), contents.size());
+        return true;
+    }
+
+    /**
+     *  Parses [rangeBegin, rangeEnd) of the mapped file, which must start on a
+     * line boundary, split into blocks that are parsed independently (in parallel
+     * when more than one thread is configured) and joined in file order.
+     * Records are appended to data and warnings are reported with file line
+     * numbers counted from firstLine.
+     * @return The number of lines in the range.
+     */
+    template <typename Record, typename Allocator>
+    int parseRange(std::string_view contents, size_t rangeBegin, size_t rangeEnd, int firstLine,
+                   int countryColumnIndex, int startYear, int endYear, unsigned threadCount,
+                   std::vector<Record, Allocator>& data, int& validRecords, int& skippedRecords) {
+        if (threadCount == 0) {
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+        
+        const std::vector<size_t> boundaries = splitAtLineBoundaries(contents, rangeBegin, rangeEnd, threadCount);
+        std::vector<ChunkResult<Record>> chunks(boundaries.size() - 1);
+        
+        if (chunks.size() == 1) {
+            parseChunk(contents, boundaries[0], boundaries[1], countryColumnIndex, startYear, endYear, chunks[0]);
+        } else {
+            std::vector<std::thread> workers;
+            workers.reserve(chunks.size());
+            for (size_t i = 0; i < chunks.size(); ++i) {
+                workers.emplace_back(parseChunk<Record>, contents, boundaries[i], boundaries[i + 1],
+                                     countryColumnIndex, startYear, endYear, std::ref(chunks[i]));
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+        
+        // Join in file order; line numbers continue from one block to the next
+        size_t totalRecords = data.size();
+        for (const auto& chunk : chunks) {
+            totalRecords += chunk.records.size();
+        }
+        data.reserve(totalRecords);
+        
+        int lineOffset = firstLine - 1;
+        
+        for (auto& chunk : chunks) {
+            for (const auto& [line, temperature] : chunk.unusualValues) {
+                reportUnusualTemperature(temperature, lineOffset + line);
+            }
+            std::move(chunk.records.begin(), chunk.records.end(), std::back_inserter(data));
+            validRecords += chunk.validRecords;
+            skippedRecords += chunk.skippedRecords;
+            lineOffset += chunk.lineCount;
+        }
+        
+        return lineOffset - (firstLine - 1);
+    }
+
+    /**
+     *  Finds the byte range of the requested years through the persisted year
+     * index, building and saving the index first if needed. The range is left
+     * untouched when the file cannot be indexed.
+     */
+    void restrictToYears(const std::string& filename, std::string_view contents, size_t bodyStart,
+                         int startYear, int endYear, size_t& rangeBegin, size_t& rangeEnd, int& firstLine) {
+        YearIndex index;
+        if (YearIndex::load(filename, index)) {
+            index.findRange(startYear, endYear, rangeBegin, rangeEnd, firstLine);
+        } else if (buildYearIndex(contents, bodyStart, index)) {
+            index.save(filename);
+            index.findRange(startYear, endYear, rangeBegin, rangeEnd, firstLine);
+        }
+    }
+
+    /**
+     *  Memory-mapped loader: maps the file, narrows the scan to the requested
+     * years when the file has (or can get) a year index, and parses the rest.
+     * Records are appended to data, whose allocator decides where they live.
+     */
+    template <typename Record, typename Allocator>
+    void loadMapped(const std::string& filename, const std::string& countryCode, 
+                    int startYear, int endYear, unsigned threadCount, bool useYearIndex,
+                    std::vector<Record, Allocator>& data) {
+        MappedFile file(filename);
+        
+        std::string_view header;
+        size_t bodyStart = 0;
+        if (!openMappedCSV(filename, file, header, bodyStart)) {
+            return;
+        }
+        
+        const int countryColumnIndex = resolveCountryColumn(filename, header, countryCode);
+        if (countryColumnIndex == -1) {
+            return;
+        }
+        
+        const std::string_view contents = file.view();
+        size_t rangeBegin = bodyStart;
+        size_t rangeEnd = contents.size();
+        int firstLine = 2;
+        
+        if (useYearIndex) {
+            restrictToYears(filename, contents, bodyStart, startYear, endYear, rangeBegin, rangeEnd, firstLine);
+        }
+        
+        int validRecords = 0;
+        int skippedRecords = 0;
+        parseRange(contents, rangeBegin, rangeEnd, firstLine, countryColumnIndex, startYear, endYear,
+                   threadCount, data, validRecords, skippedRecords);
+        
+        printLoadSummary(validRecords, skippedRecords);
+    }
+
+    /**
+     *  Gzip loader. Decompressed chunks arrive from the GzipReader thread while
+     * the previous chunk is parsed; each parse covers the complete lines
+     * received so far and the partial last line is carried into the next chunk.
+     * @param inputBytes Receives the most memory held in decompressed input at once.
+     * @return false (after reporting the error) if the file or column cannot be read.
+     */
+    bool streamGzip(const std::string& filename, const std::string& countryCode, size_t chunkBytes,
+                    BatchParser& parser, size_t& inputBytes) {
+        constexpr size_t QUEUED_CHUNKS = 4;
+        GzipReader reader(filename, chunkBytes, QUEUED_CHUNKS);
+        
+        if (!reader.isOpen()) {
+            std::cerr << "Error: Could not open file '" << filename << "'" << std::endl;
+            std::cerr << "Please ensure the file exists in the same directory as the executable." << std::endl;
+            return false;
+        }
+        
+        std::string buffer;
+        std::string chunk;
+        bool headerRead = false;
+        size_t peakBuffer = 0;
+        
+        // The buffer ends with the last newline parsed, plus whatever partial line follows
+        while (reader.read(chunk)) {
+            buffer.append(chunk);
+            peakBuffer = std::max(peakBuffer, buffer.capacity() + chunk.capacity());
+            
+            size_t bodyStart = 0;
+            if (!headerRead) {
+                const size_t headerEnd = buffer.find('\n');
+                if (headerEnd == std::string::npos) continue;
+                
+                const std::string_view header = stripCarriageReturn(std::string_view(buffer).substr(0, headerEnd));
+                const int countryColumnIndex = resolveCountryColumn(filename, header, countryCode);
+                if (countryColumnIndex == -1) {
+                    return false;
+                }
+                parser.setColumn(countryColumnIndex, 2);
+                headerRead = true;
+                bodyStart = headerEnd + 1;
+            }
+            
+            const size_t lastNewline = buffer.rfind('\n');
+            if (lastNewline == std::string::npos || lastNewline < bodyStart) continue;
+            
+            parser.parse(buffer, bodyStart, lastNewline + 1);
+            buffer.erase(0, lastNewline + 1);
         }
         
-        double temperature;
-        try {
-            temperature = std::stod(tempStr);
+        // Chunks waiting in the queue and the one being inflated, besides the two held here
+        inputBytes = peakBuffer + QUEUED_CHUNKS * chunkBytes;
+        
+        const std::string error = reader.errorMessage();
+        if (!error.empty()) {
+            std::cerr << "Error: Could not decompress '" << filename << "': " << error << std::endl;
+        }
+        
+        if (!headerRead) {
+            // A header without a line ending is still a header, but no rows follow it
+            const std::string_view header = stripCarriageReturn(buffer);
+            if (header.empty()) {
+                std::cerr << "Error: Could not read header from file." << std::endl;
+                return false;
+            }
+            if (resolveCountryColumn(filename, header, countryCode) == -1) {
+                return false;
+            }
+            return true;
+        }
+        
+        // Unterminated last line
+        if (!buffer.empty()) {
+            parser.parse(buffer, 0, buffer.size());
+        }
+        parser.finish();
+        return true;
+    }
+
+    std::vector<TemperatureRecord> loadGzip(const std::string& filename, const std::string& countryCode, 
+                                            int startYear, int endYear) {
+        std::vector<TemperatureRecord> data;
+        constexpr size_t CHUNK_BYTES = 1 << 20;
+        
+        // A single unbounded batch: the sink receives every record at the end
+        BatchParser parser(startYear, endYear, std::numeric_limits<size_t>::max(),
+                           [&data](std::vector<TemperatureRecord>& batch) { data.swap(batch); });
+        size_t inputBytes = 0;
+        if (streamGzip(filename, countryCode, CHUNK_BYTES, parser, inputBytes)) {
+            printLoadSummary(parser.validRecords(), parser.skippedRecords());
+        }
+        return data;
+    }
+
+    /**
+     *  Parses every country column of the file into the cache layout.
+     * Only regular files are cached: every row must have all country columns
+     * and a timestamp on the hour that round-trips through DateTime with the
+     * same layout as the first row. Anything else leaves the CSV uncached.
+     */
+    bool buildCacheColumns(std::string_view contents, const DatasetCatalog& catalog, size_t bodyStart,
+                           TemperatureCache::CacheColumns& columns) {
+        std::vector<size_t> countryColumns;
+        for (size_t id = 0; id < catalog.countryCount(); ++id) {
+            columns.countryCodes.push_back(catalog.countryCodes()[id]);
+            countryColumns.push_back(static_cast<size_t>(catalog.columnIndex(static_cast<DatasetCatalog::CountryId>(id))));
+        }
+        
+        if (countryColumns.empty()) {
+            return false;
+        }
+        
+        columns.temperatures.resize(countryColumns.size());
+        RowCells row(countryColumns.back() + 1);
+        std::string dateScratch;
+        std::string tempScratch;
+        bool layoutKnown = false;
+        size_t lineStart = bodyStart;
+        
+        while (lineStart < contents.size()) {
+            scanNextRow(contents, lineStart, row);
+            if (row.line.empty()) return false;
+            if (row.count < row.ends.size()) return false;
+            
+            const std::string_view dateStr = cleanCell(row.cell(0), dateScratch);
+            DateTime dateTime;
+            char separator = '\0';
+            size_t consumed = 0;
+            if (!DateTime::parse(dateStr, dateTime, separator, consumed) ||
+                dateTime.minute != 0 || dateTime.second != 0) {
+                return false;
+            }
             
-            // ENHANCED: Sanity check for temperature values (reasonable range for Earth)
-            if (temperature < -100.0 || temperature > 100.0) {
-                std::cerr << "Warning: Unusual temperature value " << temperature 
-                          << "°C on line " << lineNumber << ". Skipping." << std::endl;
+            const std::string_view suffix = dateStr.substr(consumed);
+            if (!layoutKnown) {
+                columns.dateTimeSeparator = separator;
+                columns.timestampSuffix = std::string(suffix);
+                layoutKnown = true;
+            } else if (separator != columns.dateTimeSeparator || suffix != columns.timestampSuffix) {
+                return false;
+            }
+            columns.epochHours.push_back(dateTime.toEpochHours());
+            
+            for (size_t c = 0; c < countryColumns.size(); ++c) {
+                double temperature;
+                float stored;
+                switch (readTemperatureCell(row.cell(countryColumns[c]), tempScratch, temperature)) {
+                    case CellStatus::Valid:
+                        stored = static_cast<float>(temperature);
+                        break;
+                    case CellStatus::Missing:
+                        stored = TemperatureCache::missingValue();
+                        break;
+                    case CellStatus::OutOfRange:
+                        // Keep the value, but make sure float rounding cannot pull it back into range
+                        stored = static_cast<float>(temperature);
+                        if (std::abs(stored) <= Constants::TEMP_RANGE_SANITY_CHECK) {
+                            stored = std::nextafter(stored, temperature > 0 ? HUGE_VALF : -HUGE_VALF);
+                        }
+                        break;
+                    case CellStatus::Invalid:
+                    default:
+                        stored = TemperatureCache::invalidValue();
+                        break;
+                }
+                columns.temperatures[c].push_back(stored);
+            }
+        }
+        
+        return !columns.epochHours.empty();
+    }
+
+    /**
+     *  Builds the binary cache for a CSV file after it has been loaded from text.
+     * The cache holds every country, so this is a second full parse of the
+     * file, paid once in the foreground by the first run; later runs skip the
+     * text entirely. Irregular files are given up on at the first row that
+     * cannot be cached. Failure is not an error: the next run simply parses
+     * the text again.
+     */
+    void writeCache(const std::string& filename) {
+        MappedFile file(filename);
+        if (!file.isOpen() || file.size() == 0) return;
+        
+        const std::string_view contents = file.view();
+        size_t headerEnd = contents.find('\n');
+        if (headerEnd == std::string_view::npos) return;
+        
+        const auto catalog = DatasetCatalog::forHeader(filename, stripCarriageReturn(contents.substr(0, headerEnd)));
+        TemperatureCache::CacheColumns columns;
+        if (buildCacheColumns(contents, *catalog, headerEnd + 1, columns) &&
+            TemperatureCache::write(filename, columns)) {
+            std::cout << "Binary cache written to " << TemperatureCache::cachePathFor(filename)
+                      << " (one extra parse of all " << columns.countryCodes.size()
+                      << " countries; later runs skip the text)" << std::endl;
+        }
+    }
+
+    /**
+     *  Loads one country from a validated cache, applying the same year window,
+     * missing-value and sanity rules as the text loaders. Rows map to line
+     * numbers directly because cached files contain no blank lines.
+     */
+    template <typename Allocator>
+    void loadFromCache(const TemperatureCache::Reader& cache, int country,
+                       int startYear, int endYear, std::vector<CompactTemperatureRecord, Allocator>& data) {
+        int validRecords = 0;
+        int skippedRecords = 0;
+        
+        for (size_t row = 0; row < cache.rowCount(); ++row) {
+            const int year = DateTime::fromEpochHours(cache.epochHoursAt(row)).year;
+            if (year < startYear || year > endYear) continue;
+            
+            const float value = cache.temperatureAt(country, row);
+            if (TemperatureCache::isMissing(value)) continue;
+            if (TemperatureCache::isInvalid(value)) {
                 skippedRecords++;
                 continue;
             }
             
-        } catch (const std::exception& e) {
-            skippedRecords++;
+            if (value < -Constants::TEMP_RANGE_SANITY_CHECK || value > Constants::TEMP_RANGE_SANITY_CHECK) {
+                reportUnusualTemperature(value, static_cast<int>(row) + 2);
+                skippedRecords++;
+                continue;
+            }
+            
+            data.push_back({cache.epochHoursAt(row), value});
+            validRecords++;
+        }
+        
+        printLoadSummary(validRecords, skippedRecords);
+    }
+
+    /**
+     *  Shared body of both loadCompact() overloads; data must be empty.
+     */
+    template <typename Allocator>
+    void loadCompactInto(const std::string& filename, const std::string& countryCode, int startYear, int endYear,
+                         const LoaderConfig& config, std::vector<CompactTemperatureRecord, Allocator>& data) {
+        // Gzip input is only parsed to text records; convert them as they are loaded
+        if (GzipReader::isGzipFile(filename)) {
+            const std::vector<TemperatureRecord> records = loadGzip(filename, countryCode, startYear, endYear);
+            data.reserve(records.size());
+            for (const auto& record : records) {
+                appendRecord(data, record.date, record.temperature);
+            }
+            return;
+        }
+        
+        if (config.useCache) {
+            const TemperatureCache::Reader cache(filename);
+            const int country = cache.isValid() ? cache.findCountry(countryCode) : -1;
+            if (country != -1) {
+                std::cout << "Using binary cache " << TemperatureCache::cachePathFor(filename) << std::endl;
+                loadFromCache(cache, country, startYear, endYear, data);
+                return;
+            }
+        }
+        
+        loadMapped(filename, countryCode, startYear, endYear, config.threadCount, config.useYearIndex, data);
+        
+        if (config.useCache && !data.empty()) {
+            writeCache(filename);
+        }
+    }
+}
+
+std::vector<TemperatureRecord> loadCSV(const std::string& filename, const std::string& countryCode, 
+                                       int startYear, int endYear, const LoaderConfig& config) {
+    // Compressed input is always streamed; the cache and year index describe plain-text files only
+    if (GzipReader::isGzipFile(filename)) {
+        return loadGzip(filename, countryCode, startYear, endYear);
+    }
+    
+    // Always parsed from text: the cache holds floats, and these records keep
+    // the full double value of every cell
+    std::vector<TemperatureRecord> data;
+    switch (config.mode) {
+        case LoadMode::Stream:
+            data = loadStream(filename, countryCode, startYear, endYear);
+            break;
+        case LoadMode::MemoryMapped:
+        default:
+            loadMapped(filename, countryCode, startYear, endYear, config.threadCount, config.useYearIndex, data);
+            break;
+    }
+    
+    return data;
+}
+
+std::vector<CompactTemperatureRecord> loadCompact(const std::string& filename, const std::string& countryCode,
+                                                  int startYear, int endYear, const LoaderConfig& config) {
+    std::vector<CompactTemperatureRecord> data;
+    loadCompactInto(filename, countryCode, startYear, endYear, config, data);
+    return data;
+}
+
+void loadCompact(const std::string& filename, const std::string& countryCode, int startYear, int endYear,
+                 std::pmr::vector<CompactTemperatureRecord>& data, const LoaderConfig& config) {
+    data.clear();
+    loadCompactInto(filename, countryCode, startYear, endYear, config, data);
+}
+
+std::shared_ptr<const DatasetCatalog> loadCatalog(const std::string& filename) {
+    std::string header;
+    if (GzipReader::isGzipFile(filename)) {
+        constexpr size_t CHUNK_BYTES = 64 * 1024;
+        GzipReader reader(filename, CHUNK_BYTES, 1);
+        std::string chunk;
+        while (header.find('\n') == std::string::npos && reader.read(chunk)) {
+            header.append(chunk);
+        }
+    } else {
+        const MappedFile file(filename);
+        if (file.isOpen()) {
+            header = std::string(file.view().substr(0, file.view().find('\n')));
+        }
+    }
+    
+    header.resize(std::min(header.size(), header.find('\n')));
+    if (header.empty()) {
+        return nullptr;
+    }
+    return DatasetCatalog::forHeader(filename, stripCarriageReturn(header));
+}
+
+MultiCountryData loadCSVMulti(const std::string& filename, const std::vector<std::string>& countryCodes, 
+                              int startYear, int endYear, const LoaderConfig& config) {
+    MultiCountryData result;
+    MappedFile file(filename);
+    
+    std::string_view header;
+    size_t lineStart = 0;
+    if (!openMappedCSV(filename, file, header, lineStart)) {
+        return result;
+    }
+    
+    // Resolve every requested country to its column once; unknown codes are reported and dropped
+    std::vector<int> columnIndices;
+    std::vector<int> skippedPerCountry;
+    int maxColumnIndex = 0;
+    
+    const auto catalog = DatasetCatalog::forHeader(filename, header);
+    for (const auto& countryCode : countryCodes) {
+        const int columnIndex = catalog->columnIndex(countryCode);
+        
+        if (columnIndex == -1) {
+            reportMissingCountry(*catalog, countryCode);
             continue;
         }
         
-        data.push_back(TemperatureRecord(dateStr, temperature));
-        validRecords++;
+        CountrySeries series;
+        series.countryCode = countryCode;
+        result.series.push_back(std::move(series));
+        columnIndices.push_back(columnIndex);
+        skippedPerCountry.push_back(0);
+        maxColumnIndex = std::max(maxColumnIndex, columnIndex);
+    }
+    
+    if (result.series.empty()) {
+        return result;
+    }
+    
+    const std::string_view contents = file.view();
+    RowCells row(static_cast<size_t>(maxColumnIndex) + 1); // Tokenise once, up to the right-most requested column
+    int lineNumber = 1;
+    std::string dateScratch;
+    std::string tempScratch;
+    
+    // Quantized mode: a row's values are collected first, then every series gets a slot for a stored date
+    const bool quantize = config.quantizeTemperatures;
+    std::vector<int16_t> rowValues(quantize ? result.series.size() : 0);
+    
+    while (lineStart < contents.size()) {
+        scanNextRow(contents, lineStart, row);
+        lineNumber++;
+        
+        if (row.line.empty()) continue;
+        
+        const std::string_view dateStr = cleanCell(row.cell(0), dateScratch);
+        int year = 0;
+        const bool validDate = parseRowYear(dateStr, year);
+        
+        // The date is stored at most once per row, on first use by any country
+        bool dateStored = false;
+        std::fill(rowValues.begin(), rowValues.end(), QuantizedTemperature::MISSING);
+        
+        for (size_t s = 0; s < result.series.size(); ++s) {
+            const size_t columnIndex = static_cast<size_t>(columnIndices[s]);
+            
+            if (columnIndex >= row.count || !validDate) {
+                skippedPerCountry[s]++;
+                continue;
+            }
+            
+            if (year < startYear || year > endYear) continue;
+            
+            double temperature;
+            const CellStatus status = readTemperatureCell(row.cell(columnIndex), tempScratch, temperature);
+            if (status == CellStatus::Missing) continue;
+            if (status != CellStatus::Valid) {
+                if (status == CellStatus::OutOfRange) reportUnusualTemperature(temperature, lineNumber);
+                skippedPerCountry[s]++;
+                continue;
+            }
+            
+            if (!dateStored) {
+                result.dates.emplace_back(dateStr);
+                dateStored = true;
+            }
+            
+            if (quantize) {
+                rowValues[s] = QuantizedTemperature::encode(temperature);
+                continue;
+            }
+            
+            CountrySeries& series = result.series[s];
+            series.dateIndices.push_back(static_cast<uint32_t>(result.dates.size() - 1));
+            series.temperatures.push_back(temperature);
+        }
+        
+        if (quantize && dateStored) {
+            for (size_t s = 0; s < result.series.size(); ++s) {
+                result.series[s].centiDegrees.push_back(rowValues[s]);
+            }
+        }
     }
     
-    file.close();
+    std::cout << "Data loading summary (" << result.series.size() << " countries, "
+              << result.dates.size() << " distinct timestamps):" << std::endl;
+    for (size_t s = 0; s < result.series.size(); ++s) {
+        std::cout << "  " << result.series[s].countryCode << ": " 
+                  << result.series[s].size() << " valid records";
+        if (skippedPerCountry[s] > 0) {
+            std::cout << ", " << skippedPerCountry[s] << " skipped";
+        }
+        std::cout << std::endl;
+    }
+    
+    return result;
+}
+
+BatchLoadStats loadCSVBatches(const std::string& filename, const std::string& countryCode, int startYear, int endYear,
+                              const BatchConsumer& consumer, const LoaderConfig& config) {
+    // A batch record: the struct plus a heap-allocated timestamp string
+    constexpr size_t ESTIMATED_RECORD_BYTES = sizeof(TemperatureRecord) + 32;
+    constexpr size_t MIN_CHUNK_BYTES = 4096;
+    constexpr size_t MAX_CHUNK_BYTES = 1 << 20;
+    
+    BatchLoadStats stats;
+    const bool compressed = GzipReader::isGzipFile(filename);
     
-    // ENHANCED: Provide summary of data loading
-    std::cout << "Data loading summary:" << std::endl;
-    std::cout << "  Valid records loaded: " << validRecords << std::endl;
-    if (skippedRecords > 0) {
-        std::cout << "  Records skipped: " << skippedRecords << std::endl;
+    // Compressed input needs its own buffers: a quarter of the budget, over six chunks
+    const size_t budget = std::max<size_t>(config.memoryBudgetBytes, 64 * 1024);
+    const size_t inputBudget = compressed ? budget / 4 : 0;
+    const size_t chunkBytes = std::clamp(inputBudget / 6, MIN_CHUNK_BYTES, MAX_CHUNK_BYTES);
+    
+    BatchParser parser(startYear, endYear, (budget - inputBudget) / ESTIMATED_RECORD_BYTES,
+                       [&consumer](std::vector<TemperatureRecord>& batch) { consumer(batch); });
+    size_t inputBytes = 0;
+    
+    if (compressed) {
+        stats.succeeded = streamGzip(filename, countryCode, chunkBytes, parser, inputBytes);
+    } else {
+        // The mapping is backed by the page cache, which the kernel reclaims as the scan moves on
+        MappedFile file(filename);
+        std::string_view header;
+        size_t bodyStart = 0;
+        if (openMappedCSV(filename, file, header, bodyStart)) {
+            const int countryColumnIndex = resolveCountryColumn(filename, header, countryCode);
+            if (countryColumnIndex != -1) {
+                const std::string_view contents = file.view();
+                size_t rangeBegin = bodyStart;
+                size_t rangeEnd = contents.size();
+                int firstLine = 2;
+                if (config.useYearIndex) {
+                    restrictToYears(filename, contents, bodyStart, startYear, endYear, rangeBegin, rangeEnd, firstLine);
+                }
+                
+                parser.setColumn(countryColumnIndex, firstLine);
+                parser.parse(contents, rangeBegin, rangeEnd);
+                parser.finish();
+                stats.succeeded = true;
+            }
+        }
     }
     
-    return data;
+    if (!stats.succeeded) {
+        return stats;
+    }
+    
+    stats.recordCount = static_cast<size_t>(parser.validRecords());
+    stats.skippedRecords = static_cast<size_t>(parser.skippedRecords());
+    stats.batchCount = parser.batchCount();
+    stats.batchCapacity = parser.batchCapacity();
+    stats.peakLoaderBytes = parser.peakBatchBytes() + inputBytes;
+    
+    printLoadSummary(parser.validRecords(), parser.skippedRecords());
+    std::cout << "  Batches: " << stats.batchCount << " of up to " << stats.batchCapacity << " records" << std::endl;
+    std::cout << "  Peak loader memory: " << stats.peakLoaderBytes / 1024 << " KiB (budget "
+              << budget / 1024 << " KiB)" << std::endl;
+    return stats;
+}
+
+FollowStatus loadAppended(const std::string& filename, const std::string& countryCode, int startYear, int endYear,
+                          FollowState& state, std::vector<TemperatureRecord>& newRecords, const LoaderConfig& config) {
+    constexpr size_t TAIL_CHECK_BYTES = 64;
+    newRecords.clear();
+    
+    MappedFile file(filename);
+    std::string_view header;
+    size_t bodyStart = 0;
+    if (!openMappedCSV(filename, file, header, bodyStart)) {
+        return FollowStatus::Failed;
+    }
+    
+    const int countryColumnIndex = resolveCountryColumn(filename, header, countryCode);
+    if (countryColumnIndex == -1) {
+        return FollowStatus::Failed;
+    }
+    
+    // Only rows whose line ending has been written are consumed; a partial last row waits for the next call
+    const std::string_view contents = file.view();
+    const size_t lastNewline = contents.rfind('\n');
+    const size_t completeEnd = lastNewline == std::string_view::npos ? 0 : lastNewline + 1;
+    
+    const bool hasState = state.offset > 0;
+    const bool replaced = hasState &&
+        (contents.size() < state.offset || header != state.header ||
+         contents.substr(state.offset - state.consumedTail.size(), state.consumedTail.size()) != state.consumedTail);
+    
+    int validRecords = 0;
+    int skippedRecords = 0;
+    FollowStatus status;
+    
+    if (!hasState || replaced) {
+        if (replaced) {
+            std::cout << "Data file was truncated or replaced; reloading " << filename << std::endl;
+        }
+        
+        size_t rangeBegin = std::min(bodyStart, completeEnd);
+        size_t rangeEnd = completeEnd;
+        int firstLine = 2;
+        if (config.useYearIndex) {
+            restrictToYears(filename, contents, bodyStart, startYear, endYear, rangeBegin, rangeEnd, firstLine);
+            rangeBegin = std::min(rangeBegin, completeEnd);
+            rangeEnd = std::min(rangeEnd, completeEnd);
+        }
+        
+        const int linesParsed = parseRange(contents, rangeBegin, rangeEnd, firstLine, countryColumnIndex, startYear,
+                                           endYear, config.threadCount, newRecords, validRecords, skippedRecords);
+        
+        // Lines outside the indexed window are not parsed but still count towards later line numbers
+        if (firstLine > 0) {
+            state.linesConsumed = (firstLine - 1) + linesParsed +
+                static_cast<int>(std::count(contents.begin() + rangeEnd, contents.begin() + completeEnd, '\n'));
+        } else {
+            state.linesConsumed = static_cast<int>(std::count(contents.begin(), contents.begin() + completeEnd, '\n'));
+        }
+        state.header = std::string(header);
+        status = FollowStatus::Reloaded;
+    } else {
+        if (completeEnd <= state.offset) {
+            return FollowStatus::Unchanged;
+        }
+        
+        const int linesParsed = parseRange(contents, state.offset, completeEnd, state.linesConsumed + 1,
+                                           countryColumnIndex, startYear, endYear, config.threadCount,
+                                           newRecords, validRecords, skippedRecords);
+        state.linesConsumed += linesParsed;
+        status = FollowStatus::Appended;
+    }
+    
+    state.offset = completeEnd;
+    const size_t tailSize = std::min(TAIL_CHECK_BYTES, completeEnd);
+    state.consumedTail = std::string(contents.substr(completeEnd - tailSize, tailSize));
+    
+    printLoadSummary(validRecords, skippedRecords);
+    return status;
 }
 
 } // namespace DataLoader
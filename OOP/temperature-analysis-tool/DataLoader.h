@@ -3,14 +3,168 @@
 
 #include <string>
 #include <vector>
+#include <memory_resource>
+#include <functional>
+#include <cstddef>
+#include <memory>
 #include "TemperatureRecord.h"
+#include "CompactTemperatureRecord.h"
+#include "MultiCountryData.h"
+#include "DatasetCatalog.h"
 
 namespace DataLoader {
+    /**
+     *  Selects how the CSV file is read from disk.
+     */
+    enum class LoadMode {
+        Stream,         // std::ifstream + std::getline, one std::string per line
+        MemoryMapped    // mmap the file and scan it in place with std::string_view cursors
+    };
+
+    /**
+     *  Configuration for CSV loading
+     */
+    struct LoaderConfig {
+        LoadMode mode{LoadMode::MemoryMapped};
+        unsigned threadCount{0};    // MemoryMapped only: parser threads, 0 = one per hardware thread
+        bool useCache{true};        // loadCompact only: read/write the binary sidecar cache (see TemperatureCache.h)
+        bool useYearIndex{true};    // MemoryMapped only: seek via the persisted year index (see YearIndex.h)
+        size_t memoryBudgetBytes{64u << 20}; // loadCSVBatches only: bound on record batches and input buffers
+        bool quantizeTemperatures{false};    // loadCSVMulti only: int16 centi-degree columns (see QuantizedTemperature.h)
+    };
+
+    /**
+     *  Reads only the header row of filename (plain or gzip) and returns the
+     * file's shared catalog of country columns, or nullptr (silently) if the
+     * file cannot be read.
+     */
+    std::shared_ptr<const DatasetCatalog> loadCatalog(const std::string& filename);
+
+    /**
+     *  Loads one country's temperatures for the given years. Gzip-compressed
+     * files (".gz" or gzip magic bytes) are decompressed on the fly and
+     * streamed through the parser; for them only the filename, country and
+     * years are used. The text is always parsed, never the binary cache, whose
+     * float columns would round the values; config.useCache is ignored.
+     */
     std::vector<TemperatureRecord> loadCSV(
-        const std::string& filename, 
-        const std::string& countryCode, 
-        int startYear, 
-        int endYear
+        const std::string& filename,
+        const std::string& countryCode,
+        int startYear,
+        int endYear,
+        const LoaderConfig& config = {}
+    );
+
+    /**
+     *  Loads one country as 8-byte records (hours since 1970 + float). Rows whose
+     * timestamp is not a full "YYYY-MM-DD[ HH:MM:SS]" date are skipped, and
+     * minutes and seconds are dropped. Reads the binary cache directly when
+     * one is available; config.mode is ignored (the mapped loader is used).
+     */
+    std::vector<CompactTemperatureRecord> loadCompact(
+        const std::string& filename,
+        const std::string& countryCode,
+        int startYear,
+        int endYear,
+        const LoaderConfig& config = {}
+    );
+
+    /**
+     *  As above, but loads into data (replacing its contents) so the records are
+     * allocated from data's memory resource, e.g. a per-analysis arena.
+     */
+    void loadCompact(
+        const std::string& filename,
+        const std::string& countryCode,
+        int startYear,
+        int endYear,
+        std::pmr::vector<CompactTemperatureRecord>& data,
+        const LoaderConfig& config = {}
+    );
+
+    /**
+     *  Receives one batch of records in file order. The batch is only valid
+     * during the call; its storage is reused for the next batch.
+     */
+    using BatchConsumer = std::function<void(const std::vector<TemperatureRecord>& batch)>;
+
+    /**
+     *  Counters reported by loadCSVBatches().
+     */
+    struct BatchLoadStats {
+        bool succeeded{false};
+        size_t recordCount{0};
+        size_t skippedRecords{0};
+        size_t batchCount{0};
+        size_t batchCapacity{0};    // Records per batch, derived from the memory budget
+        size_t peakLoaderBytes{0};  // Largest batch plus decompression buffers held at once
+    };
+
+    /**
+     *  Out-of-core loading for files larger than memory: records are handed to
+     * consumer in fixed-size batches instead of being collected, so the
+     * loader's memory is bounded by config.memoryBudgetBytes rather than by the
+     * file size. Plain files are scanned through a read-only mapping (page
+     * cache, not heap); gzip files are decompressed in bounded chunks.
+     * config.mode and config.useCache are ignored.
+     */
+    BatchLoadStats loadCSVBatches(
+        const std::string& filename,
+        const std::string& countryCode,
+        int startYear,
+        int endYear,
+        const BatchConsumer& consumer,
+        const LoaderConfig& config = {}
+    );
+
+    /**
+     *  Follow-mode position in a CSV that is being appended to. A default
+     * constructed state makes the next loadAppended() call a full load; reset
+     * it when the country or year window changes.
+     */
+    struct FollowState {
+        size_t offset{0};           // End of the last complete row consumed
+        int linesConsumed{0};       // Lines up to offset, header included
+        std::string header;         // Header line when the file was first read
+        std::string consumedTail;   // Last bytes before offset, re-checked to detect a replaced file
+    };
+
+    enum class FollowStatus {
+        Unchanged,  // No complete row was appended since the last call
+        Appended,   // newRecords holds only the rows appended since the last call
+        Reloaded,   // First call, or the file was truncated or replaced: newRecords holds the whole selection
+        Failed      // The file or the country column could not be read
+    };
+
+    /**
+     *  Follow mode: parses only the complete rows appended to the file since
+     * the previous call. A row is consumed once its line ending has been
+     * written. If the file shrank, its header changed or the bytes before the
+     * remembered offset differ (truncation or log rotation), the whole file is
+     * loaded again. Uses the memory-mapped loader; config.mode and
+     * config.useCache are ignored.
+     */
+    FollowStatus loadAppended(
+        const std::string& filename,
+        const std::string& countryCode,
+        int startYear,
+        int endYear,
+        FollowState& state,
+        std::vector<TemperatureRecord>& newRecords,
+        const LoaderConfig& config = {}
+    );
+
+    /**
+     *  Loads several countries from one scan of the file. The date column is
+     * shared by all returned series; unknown country codes are reported and omitted.
+     * With config.quantizeTemperatures the series hold int16 centi-degrees.
+     */
+    MultiCountryData loadCSVMulti(
+        const std::string& filename,
+        const std::vector<std::string>& countryCodes,
+        int startYear,
+        int endYear,
+        const LoaderConfig& config = {}
     );
 }
 
@@ -0,0 +1,68 @@
+#include "DatasetCatalog.h"
+#include <mutex>
+
+//self written code start
+namespace {
+    std::string_view trimColumnName(std::string_view field) {
+        constexpr std::string_view TRIM_CHARS = " \t\"";
+        const size_t first = field.find_first_not_of(TRIM_CHARS);
+        if (first == std::string_view::npos) {
+            return std::string_view();
+        }
+        const size_t last = field.find_last_not_of(TRIM_CHARS);
+        return field.substr(first, last - first + 1);
+    }
+}
+
+DatasetCatalog::DatasetCatalog(std::string_view header) : header_(header) {
+    size_t start = 0;
+    for (int index = 0; start <= header.size(); ++index) {
+        size_t end = header.find(',', start);
+        if (end == std::string_view::npos) end = header.size();
+        
+        // Column 0 is the timestamp; the first of any duplicate columns wins
+        const std::string_view column = trimColumnName(header.substr(start, end - start));
+        if (index > 0 && column.size() > COLUMN_SUFFIX.size() &&
+            column.substr(column.size() - COLUMN_SUFFIX.size()) == COLUMN_SUFFIX) {
+            std::string code(column.substr(0, column.size() - COLUMN_SUFFIX.size()));
+            if (ids_.emplace(code, static_cast<CountryId>(codes_.size())).second) {
+                codes_.push_back(std::move(code));
+                columns_.push_back(index);
+            }
+        }
+        start = end + 1;
+    }
+}
+
+std::shared_ptr<const DatasetCatalog> DatasetCatalog::forHeader(const std::string& filename,
+                                                                std::string_view header) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::shared_ptr<const DatasetCatalog>> catalogs;
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& catalog = catalogs[filename];
+    if (!catalog || catalog->header() != header) {
+        catalog = std::make_shared<const DatasetCatalog>(header);
+    }
+    return catalog;
+}
+
+bool DatasetCatalog::findCountry(std::string_view code, CountryId& id) const {
+    const auto it = ids_.find(std::string(code));
+    if (it == ids_.end()) {
+        return false;
+    }
+    id = it->second;
+    return true;
+}
+
+bool DatasetCatalog::hasCountry(std::string_view code) const {
+    CountryId id;
+    return findCountry(code, id);
+}
+
+int DatasetCatalog::columnIndex(std::string_view code) const {
+    CountryId id;
+    return findCountry(code, id) ? columns_[id] : -1;
+}
+//self written code end
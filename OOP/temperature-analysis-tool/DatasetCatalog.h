@@ -0,0 +1,64 @@
+#ifndef DATASET_CATALOG_H
+#define DATASET_CATALOG_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <cstdint>
+
+//self written code start
+/**
+ *  The country columns of a dataset, discovered from its header row.
+ *
+ * Every "<CC>_temperature" column after the timestamp is interned to a small
+ * CountryId in header order. Looking a code up is a single hash probe and an
+ * ID maps to its column index through an array, so loaders and input
+ * validation never re-tokenise the header. forHeader() keeps one catalog per
+ * file for the life of the process.
+ */
+class DatasetCatalog {
+public:
+    using CountryId = uint16_t;
+
+    static constexpr std::string_view COLUMN_SUFFIX = "_temperature";
+
+    explicit DatasetCatalog(std::string_view header);
+
+    /**
+     *  Catalog of filename, whose header row is header. Parses the header the
+     * first time a file is seen (or after its header text changed) and returns
+     * the shared catalog on later calls. Thread-safe.
+     */
+    static std::shared_ptr<const DatasetCatalog> forHeader(const std::string& filename, std::string_view header);
+
+    size_t countryCount() const { return codes_.size(); }
+    bool empty() const { return codes_.empty(); }
+
+    /**
+     * @return false if the dataset has no column for code.
+     */
+    bool findCountry(std::string_view code, CountryId& id) const;
+    bool hasCountry(std::string_view code) const;
+
+    /**
+     * @return The column of the code's temperatures, or -1 if there is none.
+     */
+    int columnIndex(std::string_view code) const;
+    int columnIndex(CountryId id) const { return columns_[id]; }
+    const std::string& countryCode(CountryId id) const { return codes_[id]; }
+
+    // Codes in header order, indexed by CountryId
+    const std::vector<std::string>& countryCodes() const { return codes_; }
+    const std::string& header() const { return header_; }
+
+private:
+    std::string header_;
+    std::vector<std::string> codes_;
+    std::vector<int> columns_;
+    std::unordered_map<std::string, CountryId> ids_;
+};
+
+#endif
+//self written code end
@@ -0,0 +1,279 @@
+#ifndef DATE_TIME_H
+#define DATE_TIME_H
+
+#include <string_view>
+#include <cstdint>
+#include <type_traits>
+
+//self written code start
+/**
+ *  Calendar date and time of day decoded from the dataset's timestamp text
+ * ("YYYY-MM-DD HH:MM:SS", "YYYY-MM-DDTHH:MM:SSZ" or a bare "YYYY-MM-DD").
+ *
+ * Trivially copyable and constexpr throughout; converts to and from whole
+ * hours since 1970-01-01 so timestamps can be stored in 32 bits. Calendar
+ * arithmetic, truncation to the start of a period and formatting into a
+ * caller's buffer are integer operations, so grouping and labelling never
+ * slice or concatenate date text.
+ */
+struct DateTime {
+    int16_t year{1970};
+    uint8_t month{1};
+    uint8_t day{1};
+    uint8_t hour{0};
+    uint8_t minute{0};
+    uint8_t second{0};
+
+    /**
+     *  Parses the leading date (and optional time) of text.
+     * @param separator Receives the character between date and time ('\0' if date only).
+     * @param consumed Receives the number of characters that were parsed.
+     * @return false if the text does not start with a valid date.
+     */
+    static constexpr bool parse(std::string_view text, DateTime& out, char& separator, size_t& consumed) {
+        if (text.size() < 10 || text[4] != '-' || text[7] != '-') return false;
+
+        int year = 0, month = 0, day = 0;
+        if (!readDigits(text, 0, 4, year) || !readDigits(text, 5, 2, month) ||
+            !readDigits(text, 8, 2, day)) {
+            return false;
+        }
+        if (month < 1 || month > 12 || day < 1 || day > daysInMonth(year, month)) return false;
+
+        out = DateTime();
+        out.year = static_cast<int16_t>(year);
+        out.month = static_cast<uint8_t>(month);
+        out.day = static_cast<uint8_t>(day);
+        separator = '\0';
+        consumed = 10;
+
+        if (text.size() < 19 || (text[10] != ' ' && text[10] != 'T') || text[13] != ':' || text[16] != ':') {
+            return true;
+        }
+
+        int hour = 0, minute = 0, second = 0;
+        if (!readDigits(text, 11, 2, hour) || !readDigits(text, 14, 2, minute) ||
+            !readDigits(text, 17, 2, second) || hour > 23 || minute > 59 || second > 59) {
+            return true;
+        }
+
+        out.hour = static_cast<uint8_t>(hour);
+        out.minute = static_cast<uint8_t>(minute);
+        out.second = static_cast<uint8_t>(second);
+        separator = text[10];
+        consumed = 19;
+        return true;
+    }
+
+    /**
+     *  Parses a period key: "YYYY", "YYYY-MM" or a full date (anything after
+     * the date is ignored). Missing fields are the period's first month or day.
+     * @return false if the text is none of those.
+     */
+    static constexpr bool parsePeriod(std::string_view text, DateTime& out) {
+        int year = 0, month = 1, day = 1;
+        if (text.size() < 4 || !readDigits(text, 0, 4, year)) return false;
+        if (text.size() >= 7) {
+            if (text[4] != '-' || !readDigits(text, 5, 2, month) || month < 1 || month > 12) return false;
+        } else if (text.size() != 4) {
+            return false;
+        }
+        if (text.size() >= 10) {
+            if (text[7] != '-' || !readDigits(text, 8, 2, day) || day < 1 || day > daysInMonth(year, month)) return false;
+        } else if (text.size() > 7) {
+            return false;
+        }
+
+        out = DateTime();
+        out.year = static_cast<int16_t>(year);
+        out.month = static_cast<uint8_t>(month);
+        out.day = static_cast<uint8_t>(day);
+        return true;
+    }
+
+    static constexpr bool isLeapYear(int year) {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    static constexpr int daysInMonth(int year, int month) {
+        constexpr int DAYS[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        return (month == 2 && isLeapYear(year)) ? 29 : DAYS[month - 1];
+    }
+
+    static constexpr int daysInYear(int year) {
+        return isLeapYear(year) ? 366 : 365;
+    }
+
+    /**
+     *  Day of the year, 1 for 1 January.
+     */
+    constexpr int dayOfYear() const {
+        constexpr int DAYS_BEFORE_MONTH[] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+        return DAYS_BEFORE_MONTH[month - 1] + day + (month > 2 && isLeapYear(year) ? 1 : 0);
+    }
+
+    /**
+     *  ISO weekday: 1 for Monday through 7 for Sunday.
+     */
+    constexpr int dayOfWeek() const {
+        // 1970-01-01 was a Thursday
+        const int32_t shifted = (toEpochDays() + 3) % 7;
+        return static_cast<int>(shifted < 0 ? shifted + 7 : shifted) + 1;
+    }
+
+    /**
+     *  ISO 8601 week number (1-53). Weeks start on Monday and week 1 is the
+     * one holding the year's first Thursday, so the first and last few days of
+     * a year can belong to a week of the neighbouring year (see isoWeekYear).
+     */
+    constexpr int isoWeek() const {
+        return (weekThursday().dayOfYear() - 1) / 7 + 1;
+    }
+
+    constexpr int isoWeekYear() const {
+        return weekThursday().year;
+    }
+
+    /**
+     *  The same time of day, days later (or earlier, for a negative count).
+     */
+    constexpr DateTime addDays(int32_t days) const {
+        DateTime result = fromEpochDays(toEpochDays() + days);
+        result.hour = hour;
+        result.minute = minute;
+        result.second = second;
+        return result;
+    }
+
+    // Truncation to the first instant of the enclosing day, ISO week, month or year
+    constexpr DateTime startOfDay() const {
+        DateTime result = *this;
+        result.hour = 0;
+        result.minute = 0;
+        result.second = 0;
+        return result;
+    }
+
+    constexpr DateTime startOfWeek() const {
+        return fromEpochDays(toEpochDays() - (dayOfWeek() - 1));
+    }
+
+    constexpr DateTime startOfMonth() const {
+        DateTime result = startOfDay();
+        result.day = 1;
+        return result;
+    }
+
+    constexpr DateTime startOfYear() const {
+        DateTime result = startOfMonth();
+        result.month = 1;
+        return result;
+    }
+
+    /**
+     *  Days since 1970-01-01 (proleptic Gregorian calendar).
+     */
+    constexpr int32_t toEpochDays() const {
+        const int y = year - (month <= 2 ? 1 : 0);
+        const int era = (y >= 0 ? y : y - 399) / 400;
+        const int yearOfEra = y - era * 400;
+        const int monthIndex = month > 2 ? month - 3 : month + 9;
+        const int dayOfYear = (153 * monthIndex + 2) / 5 + day - 1;
+        const int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+        return era * 146097 + dayOfEra - 719468;
+    }
+
+    constexpr int32_t toEpochHours() const {
+        return toEpochDays() * 24 + hour;
+    }
+
+    static constexpr DateTime fromEpochDays(int32_t days) {
+        const int z = days + 719468;
+        const int era = (z >= 0 ? z : z - 146096) / 146097;
+        const int dayOfEra = z - era * 146097;
+        const int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+        const int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+        const int monthIndex = (5 * dayOfYear + 2) / 153;
+        const int month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+
+        DateTime result;
+        result.year = static_cast<int16_t>(yearOfEra + era * 400 + (month <= 2 ? 1 : 0));
+        result.month = static_cast<uint8_t>(month);
+        result.day = static_cast<uint8_t>(dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+        return result;
+    }
+
+    static constexpr DateTime fromEpochHours(int32_t hours) {
+        const int32_t days = (hours >= 0 ? hours : hours - 23) / 24;
+        DateTime result = fromEpochDays(days);
+        result.hour = static_cast<uint8_t>(hours - days * 24);
+        return result;
+    }
+
+    /**
+     *  Three-letter English name of month (1-12), e.g. "Jan".
+     */
+    static constexpr const char* monthAbbreviation(int month) {
+        constexpr const char* NAMES[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                         "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+        return (month >= 1 && month <= 12) ? NAMES[month - 1] : "";
+    }
+
+    /**
+     *  Writes value as exactly count decimal digits (zero-padded, higher
+     * digits dropped) into buffer.
+     */
+    static constexpr void writeDigits(char* buffer, int value, int count) {
+        for (int i = count - 1; i >= 0; --i) {
+            buffer[i] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+    }
+
+    /**
+     *  Writes "YYYY-MM-DD" into buffer (10 characters, no terminator).
+     */
+    constexpr void formatDate(char* buffer) const {
+        writeDigits(buffer, year, 4);
+        buffer[4] = '-';
+        writeDigits(buffer + 5, month, 2);
+        buffer[7] = '-';
+        writeDigits(buffer + 8, day, 2);
+    }
+
+    /**
+     *  Writes "YYYY-MM-DD<separator>HH:MM:SS" into buffer (19 characters, no terminator).
+     */
+    constexpr void formatDateTime(char* buffer, char separator = ' ') const {
+        formatDate(buffer);
+        buffer[10] = separator;
+        writeDigits(buffer + 11, hour, 2);
+        buffer[13] = ':';
+        writeDigits(buffer + 14, minute, 2);
+        buffer[16] = ':';
+        writeDigits(buffer + 17, second, 2);
+    }
+
+private:
+    // The Thursday of the date's ISO week decides which year the week belongs to
+    constexpr DateTime weekThursday() const {
+        return fromEpochDays(toEpochDays() - dayOfWeek() + 4);
+    }
+
+    static constexpr bool readDigits(std::string_view text, size_t offset, size_t count, int& value) {
+        value = 0;
+        for (size_t i = offset; i < offset + count; ++i) {
+            if (text[i] < '0' || text[i] > '9') return false;
+            value = value * 10 + (text[i] - '0');
+        }
+        return true;
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<DateTime>, "DateTime is copied and stored as plain bytes");
+// 2021-01-01 (a Friday) still belongs to week 53 of 2020
+static_assert(DateTime::fromEpochDays(18628).isoWeek() == 53 && DateTime::fromEpochDays(18628).isoWeekYear() == 2020,
+              "ISO week numbering");
+
+#endif
+//self written code end
\ No newline at end of file
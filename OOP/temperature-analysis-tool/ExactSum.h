@@ -0,0 +1,34 @@
+#ifndef EXACT_SUM_H
+#define EXACT_SUM_H
+
+#include <cstdint>
+
+//self written code start
+/**
+ *  Running sum of temperatures in fixed point with 40 fraction bits, held in
+ * a 128-bit integer.
+ *
+ * Integer addition is associative, so partial sums can be merged in any
+ * grouping (days into months, per-thread slices into one total) and give the
+ * same total bit for bit; the double is rounded once, when value() is read.
+ * Every addend must be below 2^23 in magnitude. Float readings of at least
+ * 2^-17 in magnitude (every reading the loaders produce, since the dataset
+ * has three decimals) are held exactly; bits below 2^-40 of other values are
+ * dropped, always in the same way, so merging stays exact.
+ */
+class ExactSum {
+public:
+    void add(double value) { fixed_ += static_cast<int64_t>(value * SCALE); }
+    void merge(const ExactSum& other) { fixed_ += other.fixed_; }
+
+    double value() const { return static_cast<double>(fixed_) / SCALE; }
+
+private:
+    // 2^40: scaling by a power of two is exact
+    static constexpr double SCALE = 1099511627776.0;
+
+    __int128 fixed_{0};
+};
+
+#endif
+//self written code end
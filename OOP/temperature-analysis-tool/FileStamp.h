@@ -0,0 +1,36 @@
+#ifndef FILE_STAMP_H
+#define FILE_STAMP_H
+
+#include <string>
+#include <filesystem>
+#include <cstdint>
+
+//self written code start
+/**
+ *  Size and modification time of a file. Sidecar files (cache, index) store
+ * the stamp of the CSV they were built from and are discarded when it changes.
+ */
+struct FileStamp {
+    uint64_t size{0};
+    int64_t modifiedTime{0};
+
+    static bool read(const std::string& path, FileStamp& stamp) {
+        std::error_code error;
+        stamp.size = std::filesystem::file_size(path, error);
+        if (error) return false;
+
+        const auto writeTime = std::filesystem::last_write_time(path, error);
+        if (error) return false;
+
+        stamp.modifiedTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+        return true;
+    }
+
+    bool operator==(const FileStamp& other) const {
+        return size == other.size && modifiedTime == other.modifiedTime;
+    }
+    bool operator!=(const FileStamp& other) const { return !(*this == other); }
+};
+
+#endif
+//self written code end
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "GzipReader.h"
+#include <fstream>
+#include <string_view>
+#include <climits>
+#include <algorithm>
+#include <zlib.h>
+
+//self written code start
+GzipReader::GzipReader(const std::string& path, size_t chunkSize, size_t maxQueuedChunks)
+    : chunkSize_(std::min<size_t>(std::max<size_t>(chunkSize, 4096), INT_MAX)),
+      maxQueuedChunks_(std::max<size_t>(maxQueuedChunks, 1)),
+      isOpen_(false), finished_(false), stopping_(false) {
+    gzFile file = gzopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return;
+    }
+
+    // zlib's own input buffer; the default 8 KiB means far more read() calls
+    gzbuffer(file, 256 * 1024);
+    isOpen_ = true;
+    producer_ = std::thread(&GzipReader::produce, this, static_cast<void*>(file));
+}
+
+GzipReader::~GzipReader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    spaceFree_.notify_all();
+    if (producer_.joinable()) {
+        producer_.join();
+    }
+}
+
+bool GzipReader::isGzipFile(const std::string& path) {
+    constexpr std::string_view EXTENSION = ".gz";
+    if (path.size() >= EXTENSION.size() && path.compare(path.size() - EXTENSION.size(), EXTENSION.size(), EXTENSION) == 0) {
+        return true;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    unsigned char magic[2] = {0, 0};
+    file.read(reinterpret_cast<char*>(magic), sizeof(magic));
+    return file.gcount() == 2 && magic[0] == 0x1f && magic[1] == 0x8b;
+}
+
+bool GzipReader::read(std::string& chunk) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    chunkReady_.wait(lock, [this] { return !chunks_.empty() || finished_; });
+    if (chunks_.empty()) {
+        return false;
+    }
+
+    chunk = std::move(chunks_.front());
+    chunks_.pop_front();
+    lock.unlock();
+    spaceFree_.notify_one();
+    return true;
+}
+
+std::string GzipReader::errorMessage() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return error_;
+}
+
+void GzipReader::produce(void* handle) {
+    gzFile file = static_cast<gzFile>(handle);
+    std::string error;
+    bool stopped = false;
+
+    while (true) {
+        std::string chunk(chunkSize_, '\0');
+        const int bytesRead = gzread(file, chunk.data(), static_cast<unsigned>(chunk.size()));
+        if (bytesRead < 0) {
+            int code = Z_OK;
+            error = gzerror(file, &code);
+            break;
+        }
+        if (bytesRead == 0) {
+            break;
+        }
+        chunk.resize(static_cast<size_t>(bytesRead));
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        spaceFree_.wait(lock, [this] { return chunks_.size() < maxQueuedChunks_ || stopping_; });
+        if (stopping_) {
+            stopped = true;
+            break;
+        }
+        chunks_.push_back(std::move(chunk));
+        lock.unlock();
+        chunkReady_.notify_one();
+    }
+
+    // zlib flags a file cut short (Z_BUF_ERROR) without failing the final read
+    if (error.empty() && !stopped) {
+        int code = Z_OK;
+        const char* message = gzerror(file, &code);
+        if (code != Z_OK) error = message;
+    }
+    gzclose(file);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finished_ = true;
+        error_ = std::move(error);
+    }
+    chunkReady_.notify_all();
+}
+//self written code end
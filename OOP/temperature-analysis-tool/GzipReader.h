@@ -0,0 +1,65 @@
+#ifndef GZIP_READER_H
+#define GZIP_READER_H
+
+#include <string>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <cstddef>
+
+//self written code start
+/**
+ *  Streaming decompression of a gzip file on a background thread.
+ *
+ * A producer thread inflates the file with zlib into fixed-size chunks and
+ * hands them over through a bounded queue, so the caller can parse one chunk
+ * while the next is being decompressed. Memory use is bounded by
+ * (maxQueuedChunks + 2) * chunkSize regardless of the file size.
+ */
+class GzipReader {
+public:
+    explicit GzipReader(const std::string& path, size_t chunkSize = 1 << 20, size_t maxQueuedChunks = 4);
+    ~GzipReader();
+
+    GzipReader(const GzipReader&) = delete;
+    GzipReader& operator=(const GzipReader&) = delete;
+
+    /**
+     *  True if the path ends in ".gz" or the file starts with the gzip magic bytes.
+     */
+    static bool isGzipFile(const std::string& path);
+
+    bool isOpen() const { return isOpen_; }
+
+    /**
+     *  Blocks until the next chunk of decompressed bytes is available.
+     * Chunks end at arbitrary byte positions, not on line boundaries.
+     * @return false once the stream is exhausted or decompression failed.
+     */
+    bool read(std::string& chunk);
+
+    /**
+     * @return An empty string, or the zlib error that ended the stream early.
+     */
+    std::string errorMessage() const;
+
+private:
+    void produce(void* file);
+
+    size_t chunkSize_;
+    size_t maxQueuedChunks_;
+    bool isOpen_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable chunkReady_;
+    std::condition_variable spaceFree_;
+    std::deque<std::string> chunks_;
+    bool finished_;
+    bool stopping_;
+    std::string error_;
+    std::thread producer_;
+};
+
+#endif
+//self written code end
@@ -0,0 +1,167 @@
+#include "IncrementalCandlesticks.h"
+#include "TimeGrid.h"
+
+//self written code start
+namespace {
+    constexpr int32_t HOURS_PER_DAY = 24;
+}
+
+void IncrementalCandlesticks::Partial::add(double temperature) {
+    if (count == 0) {
+        high = temperature;
+        low = temperature;
+    }
+    sum += temperature;
+    if (temperature > high) high = temperature;
+    if (temperature < low) low = temperature;
+    count++;
+}
+
+IncrementalCandlesticks::IncrementalCandlesticks(std::vector<TimeFrame> timeframes, CandleClosed onCandleClosed)
+    : onCandleClosed_(std::move(onCandleClosed)), lastEpochHours_(0), recordCount_(0) {
+    for (TimeFrame timeframe : timeframes) {
+        if (find(timeframe) != nullptr) continue;
+
+        Track track;
+        track.timeframe = timeframe;
+        if (TimeGrid::isCyclic(timeframe)) {
+            track.hours.resize(HOURS_PER_DAY);
+        }
+        tracks_.push_back(std::move(track));
+    }
+}
+
+bool IncrementalCandlesticks::append(const CompactTemperatureRecord& record) {
+    if (recordCount_ > 0 && record.epochHours < lastEpochHours_) {
+        return false;
+    }
+    append(record.epochHours, record.temperature);
+    return true;
+}
+
+bool IncrementalCandlesticks::append(const TemperatureRecord& record) {
+    DateTime date;
+    char separator;
+    size_t consumed;
+    if (!DateTime::parse(record.date, date, separator, consumed)) {
+        return true;
+    }
+
+    const int32_t epochHours = date.toEpochHours();
+    if (recordCount_ > 0 && epochHours < lastEpochHours_) {
+        return false;
+    }
+    append(epochHours, record.temperature);
+    return true;
+}
+
+void IncrementalCandlesticks::append(int32_t epochHours, double temperature) {
+    // Calendar periods depend only on the day, so they are recomputed once per 24 hourly readings
+    const int32_t day = TimeGrid::floorDivide(epochHours, HOURS_PER_DAY);
+    const bool newDay = recordCount_ == 0 || day != TimeGrid::floorDivide(lastEpochHours_, HOURS_PER_DAY);
+    const DateTime dayStart = newDay ? DateTime::fromEpochDays(day) : DateTime();
+
+    for (Track& track : tracks_) {
+        if (TimeGrid::isCyclic(track.timeframe)) {
+            track.hours[epochHours - day * HOURS_PER_DAY].add(temperature);
+            continue;
+        }
+
+        if (newDay) {
+            track.dayPeriod = TimeGrid::periodIndex(dayStart, track.timeframe);
+        }
+        if (track.open.count > 0 && track.dayPeriod != track.openPeriod) {
+            close(track);
+        }
+        if (track.open.count == 0) {
+            track.openPeriod = track.dayPeriod;
+        }
+        track.open.add(temperature);
+    }
+
+    lastEpochHours_ = epochHours;
+    recordCount_++;
+}
+
+void IncrementalCandlesticks::close(Track& track) {
+    const double average = track.open.sum / track.open.count;
+
+    // For the first period, use the current period's average as both open and close
+    const double open = track.hasPrevious ? track.previousAverage : average;
+    track.closed.emplace_back(TimeGrid::periodStart(track.openPeriod, track.timeframe),
+                              open, average, track.open.high, track.open.low);
+
+    track.previousAverage = average;
+    track.hasPrevious = true;
+    track.open = Partial();
+
+    if (onCandleClosed_) {
+        onCandleClosed_(track.timeframe, track.closed.back());
+    }
+}
+
+std::vector<Candlestick> IncrementalCandlesticks::candlesticks(TimeFrame timeframe) const {
+    const Track* track = find(timeframe);
+    if (track == nullptr) {
+        return {};
+    }
+
+    if (TimeGrid::isCyclic(timeframe)) {
+        // Chained in hour order, as the batch path does
+        std::vector<Candlestick> candlesticks;
+        double previousPeriodAverage = 0.0;
+        bool hasPreviousPeriod = false;
+        for (int32_t hour = 0; hour < HOURS_PER_DAY; ++hour) {
+            const Partial& partial = track->hours[hour];
+            if (partial.count == 0) continue;
+
+            const double currentPeriodAverage = partial.sum / partial.count;
+            const double open = hasPreviousPeriod ? previousPeriodAverage : currentPeriodAverage;
+            candlesticks.emplace_back(TimeGrid::periodStart(hour, timeframe),
+                                      open, currentPeriodAverage, partial.high, partial.low);
+
+            previousPeriodAverage = currentPeriodAverage;
+            hasPreviousPeriod = true;
+        }
+        return candlesticks;
+    }
+
+    std::vector<Candlestick> candlesticks;
+    candlesticks.reserve(track->closed.size() + 1);
+    candlesticks.insert(candlesticks.end(), track->closed.begin(), track->closed.end());
+    if (track->open.count > 0) {
+        // Provisional candle of the open bucket, replaced by the final one when it closes
+        const double average = track->open.sum / track->open.count;
+        candlesticks.emplace_back(TimeGrid::periodStart(track->openPeriod, timeframe),
+                                  track->hasPrevious ? track->previousAverage : average,
+                                  average, track->open.high, track->open.low);
+    }
+    return candlesticks;
+}
+
+const std::vector<Candlestick>& IncrementalCandlesticks::closedCandlesticks(TimeFrame timeframe) const {
+    static const std::vector<Candlestick> none;
+    const Track* track = find(timeframe);
+    return track != nullptr ? track->closed : none;
+}
+
+void IncrementalCandlesticks::clear() {
+    for (Track& track : tracks_) {
+        Track emptyTrack;
+        emptyTrack.timeframe = track.timeframe;
+        emptyTrack.hours.resize(track.hours.size());
+        track = std::move(emptyTrack);
+    }
+    lastEpochHours_ = 0;
+    recordCount_ = 0;
+}
+
+const IncrementalCandlesticks::Track* IncrementalCandlesticks::find(TimeFrame timeframe) const {
+    for (const Track& track : tracks_) {
+        if (track.timeframe == timeframe) {
+            return &track;
+        }
+    }
+    return nullptr;
+}
+//self written code end
@@ -0,0 +1,119 @@
+#ifndef INCREMENTAL_CANDLESTICKS_H
+#define INCREMENTAL_CANDLESTICKS_H
+
+#include <vector>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+#include "Candlestick.h"
+#include "CompactTemperatureRecord.h"
+#include "TemperatureRecord.h"
+#include "Common.h"
+
+//self written code start
+/**
+ *  Candlesticks kept up to date one reading at a time, for live monitoring.
+ *
+ * For every tracked timeframe only the bucket the latest reading fell into
+ * is open: append() folds a reading into each open bucket's running sum,
+ * count, minimum and maximum in O(1). When a reading starts a new period the
+ * open bucket closes into a finished candle, which is kept and reported to
+ * the CandleClosed callback. Candles follow the rules of
+ * CandlestickCalculator::computeCandlesticks (open = previous period's
+ * average, close = this period's average), and since readings are summed in
+ * the same order the candles are identical to a full recompute over every
+ * reading appended so far.
+ *
+ * Readings must arrive in time order. Hour-of-day buckets never close, as
+ * every day returns to them; all 24 stay open.
+ */
+class IncrementalCandlesticks {
+public:
+    /**
+     *  Called with each candle as its period closes.
+     */
+    using CandleClosed = std::function<void(TimeFrame timeframe, const Candlestick& candle)>;
+
+    /**
+     * @param timeframes Timeframes to maintain; by default every timeframe.
+     * @param onCandleClosed Optional; called for every candle that closes.
+     */
+    explicit IncrementalCandlesticks(
+        std::vector<TimeFrame> timeframes = {TimeFrame::Daily, TimeFrame::Weekly, TimeFrame::Monthly,
+                                             TimeFrame::Quarterly, TimeFrame::Seasonal, TimeFrame::Yearly,
+                                             TimeFrame::HourOfDay},
+        CandleClosed onCandleClosed = nullptr);
+
+    /**
+     *  Folds one reading into the open bucket of every tracked timeframe,
+     * closing the buckets whose period has ended.
+     * @return false (and nothing changes) if the reading is earlier than the
+     *         last one appended.
+     */
+    bool append(const CompactTemperatureRecord& record);
+
+    /**
+     *  As above for a text-dated record. A record whose date does not parse is
+     * skipped, as the batch aggregation skips it, and counts as appended.
+     */
+    bool append(const TemperatureRecord& record);
+
+    /**
+     *  Every candle of timeframe so far: the closed ones followed by the open
+     * bucket's provisional candle. Empty for a timeframe that is not tracked.
+     */
+    std::vector<Candlestick> candlesticks(TimeFrame timeframe) const;
+
+    /**
+     *  Candles of timeframe whose period has closed, in order.
+     */
+    const std::vector<Candlestick>& closedCandlesticks(TimeFrame timeframe) const;
+
+    bool tracks(TimeFrame timeframe) const { return find(timeframe) != nullptr; }
+    size_t recordCount() const { return recordCount_; }
+    bool empty() const { return recordCount_ == 0; }
+
+    /**
+     *  Drops every reading and candle; the tracked timeframes and the callback stay.
+     */
+    void clear();
+
+private:
+    struct Partial {
+        double sum{0.0};
+        double high{0.0};
+        double low{0.0};
+        size_t count{0};
+
+        void add(double temperature);
+    };
+
+    /**
+     *  State of one timeframe: the open bucket, the average of the last closed
+     * one (the next candle's open) and the closed candles.
+     */
+    struct Track {
+        TimeFrame timeframe;
+        int32_t openPeriod{0};
+        // Period of the latest reading's day; recomputed only when the day changes
+        int32_t dayPeriod{0};
+        Partial open;
+        double previousAverage{0.0};
+        bool hasPrevious{false};
+        std::vector<Candlestick> closed;
+        // Hour-of-day only: the 24 buckets, all open
+        std::vector<Partial> hours;
+    };
+
+    void append(int32_t epochHours, double temperature);
+    void close(Track& track);
+    const Track* find(TimeFrame timeframe) const;
+
+    std::vector<Track> tracks_;
+    CandleClosed onCandleClosed_;
+    int32_t lastEpochHours_;
+    size_t recordCount_;
+};
+
+#endif
+//self written code end
@@ -0,0 +1,71 @@
+#include "MappedFile.h"
+#include <fstream>
+#include <sstream>
+
+//self written code start
+#ifdef _WIN32
+    #include <cstdlib>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string& path)
+    : data_(nullptr), size_(0), isOpen_(false), isMapped_(false) {
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+
+    struct stat fileInfo;
+    if (::fstat(fd, &fileInfo) != 0) {
+        ::close(fd);
+        return;
+    }
+
+    size_ = static_cast<size_t>(fileInfo.st_size);
+    if (size_ == 0) {
+        // mmap rejects zero-length mappings; an empty file is still a valid open
+        ::close(fd);
+        isOpen_ = true;
+        return;
+    }
+
+    void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping stays valid after the descriptor is closed
+
+    if (mapping != MAP_FAILED) {
+        // The loader walks the file front to back exactly once
+        ::madvise(mapping, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(mapping);
+        isMapped_ = true;
+        isOpen_ = true;
+        return;
+    }
+    size_ = 0;
+#endif
+
+    // Fallback: read the whole file into memory
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return;
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    fallbackBuffer_ = contents.str();
+    data_ = fallbackBuffer_.data();
+    size_ = fallbackBuffer_.size();
+    isOpen_ = true;
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+    if (isMapped_) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+}
+//self written code end
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+//self written code start
+/**
+ *  Read-only memory mapping of a whole file.
+ *
+ * The mapping is released when the object goes out of scope. On platforms
+ * without mmap the file is read into an owned buffer instead, so callers
+ * always see the contents through view().
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isOpen() const { return isOpen_; }
+    size_t size() const { return size_; }
+    std::string_view view() const { return std::string_view(data_, size_); }
+
+private:
+    const char* data_;
+    size_t size_;
+    bool isOpen_;
+    bool isMapped_;
+    std::string fallbackBuffer_;
+};
+
+#endif
+//self written code end
\ No newline at end of file
@@ -0,0 +1,91 @@
+#ifndef MULTI_COUNTRY_DATA_H
+#define MULTI_COUNTRY_DATA_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "TemperatureRecord.h"
+#include "QuantizedTemperature.h"
+
+//self written code start
+/**
+ *  Temperature readings of one country, referring to the shared date column
+ * of MultiCountryData by row index instead of holding its own date strings.
+ *
+ * In quantized mode (LoaderConfig::quantizeTemperatures) the readings are
+ * instead kept in centiDegrees, one int16 slot per entry of the shared date
+ * column with QuantizedTemperature::MISSING where the country has no value;
+ * dateIndices and temperatures stay empty. That is 2 bytes per value instead
+ * of 12.
+ */
+struct CountrySeries {
+    std::string countryCode;
+    std::vector<uint32_t> dateIndices;
+    std::vector<double> temperatures;
+    std::vector<int16_t> centiDegrees;
+
+    bool isQuantized() const { return !centiDegrees.empty(); }
+
+    /**
+     *  Number of valid readings.
+     */
+    size_t size() const {
+        if (!isQuantized()) return temperatures.size();
+        
+        size_t count = 0;
+        for (const int16_t value : centiDegrees) {
+            count += !QuantizedTemperature::isMissing(value);
+        }
+        return count;
+    }
+
+    /**
+     *  Calls visit(dateIndex, temperature) for every valid reading in date order,
+     * decoding quantized values on the fly.
+     */
+    template <typename Visitor>
+    void forEachReading(Visitor visit) const {
+        if (isQuantized()) {
+            for (size_t i = 0; i < centiDegrees.size(); ++i) {
+                if (!QuantizedTemperature::isMissing(centiDegrees[i])) {
+                    visit(i, QuantizedTemperature::decode(centiDegrees[i]));
+                }
+            }
+            return;
+        }
+        for (size_t i = 0; i < temperatures.size(); ++i) {
+            visit(static_cast<size_t>(dateIndices[i]), temperatures[i]);
+        }
+    }
+};
+
+/**
+ *  Result of loading several countries in a single pass over the CSV file.
+ * Every timestamp that is used by at least one country is stored once in dates.
+ */
+struct MultiCountryData {
+    std::vector<std::string> dates;
+    std::vector<CountrySeries> series;
+
+    const CountrySeries* find(const std::string& countryCode) const {
+        for (const auto& s : series) {
+            if (s.countryCode == countryCode) return &s;
+        }
+        return nullptr;
+    }
+
+    /**
+     *  Expands one country into the record layout used by CandlestickCalculator.
+     */
+    std::vector<TemperatureRecord> toRecords(const CountrySeries& s) const {
+        std::vector<TemperatureRecord> records;
+        records.reserve(s.size());
+        s.forEachReading([&](size_t dateIndex, double temperature) {
+            records.emplace_back(dates[dateIndex], temperature);
+        });
+        return records;
+    }
+};
+
+#endif
+//self written code end
\ No newline at end of file
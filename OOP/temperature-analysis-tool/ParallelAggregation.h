@@ -0,0 +1,90 @@
+#ifndef PARALLEL_AGGREGATION_H
+#define PARALLEL_AGGREGATION_H
+
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cstddef>
+
+//self written code start
+/**
+ *  Splitting an ordered input into contiguous slices aggregated on separate
+ * threads.
+ *
+ * Slice boundaries are moved forward to the next change of bucket key, so
+ * every bucket lies wholly inside one slice. Each bucket is then summed by
+ * one thread in input order, exactly as a serial pass would, and joining the
+ * slices' buckets in slice order reproduces the serial result bit for bit.
+ */
+namespace ParallelAggregation {
+    // Below this many items per slice, thread start-up outweighs the work
+    constexpr size_t MIN_ITEMS_PER_SLICE = 1 << 16;
+
+    /**
+     *  The slice size sliceCount() applies, MIN_ITEMS_PER_SLICE unless lowered.
+     * Tests lower it so that small inputs are split into several slices; set it
+     * before any aggregation starts, not while one is running.
+     */
+    inline size_t& minItemsPerSlice() {
+        static size_t minimum = MIN_ITEMS_PER_SLICE;
+        return minimum;
+    }
+
+    /**
+     * @param threadCount Requested threads; 0 means one per hardware thread.
+     * @return The number of slices worth using for itemCount items (at least 1).
+     */
+    inline size_t sliceCount(unsigned threadCount, size_t itemCount) {
+        if (threadCount == 0) {
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+        return std::max<size_t>(1, std::min<size_t>(threadCount, itemCount / std::max<size_t>(1, minItemsPerSlice())));
+    }
+
+    /**
+     *  Splits [0, itemCount) into at most slices ranges that each start where
+     * keyOf(index) differs from keyOf(index - 1).
+     * @return Boundaries: slice i is [boundaries[i], boundaries[i + 1]).
+     */
+    template <typename KeyOf>
+    std::vector<size_t> splitAtKeyChanges(size_t itemCount, size_t slices, KeyOf keyOf) {
+        std::vector<size_t> boundaries;
+        boundaries.push_back(0);
+
+        for (size_t i = 1; i < slices; ++i) {
+            size_t boundary = std::max(itemCount * i / slices, boundaries.back() + 1);
+            while (boundary < itemCount && keyOf(boundary) == keyOf(boundary - 1)) {
+                ++boundary;
+            }
+            if (boundary >= itemCount) break;
+            boundaries.push_back(boundary);
+        }
+        boundaries.push_back(itemCount);
+        return boundaries;
+    }
+
+    /**
+     *  Calls work(slice, begin, end) for every slice, on its own thread when
+     * there is more than one.
+     */
+    template <typename Work>
+    void forEachSlice(const std::vector<size_t>& boundaries, Work work) {
+        const size_t slices = boundaries.size() - 1;
+        if (slices == 1) {
+            work(size_t{0}, boundaries[0], boundaries[1]);
+            return;
+        }
+
+        std::vector<std::thread> workers;
+        workers.reserve(slices);
+        for (size_t i = 0; i < slices; ++i) {
+            workers.emplace_back([&work, &boundaries, i]() { work(i, boundaries[i], boundaries[i + 1]); });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+}
+
+#endif
+//self written code end
@@ -1,6 +1,7 @@
 #include "Plotter.h"
 #include "PlotConfiguration.h"
 #include "Common.h"
+#include "TimeGrid.h"
 #include <iostream>
 #include <iomanip>
 #include <vector>
@@ -31,27 +32,27 @@ namespace {
 
     // Use reference to avoid copying data unless necessary
     struct DisplayStrategy {
-        std::vector<Candlestick> data;
+        CandlestickSeries data;
         PlotConfiguration config;
         bool wasSampled;
         bool wasCompressed;
         std::string compressionLevel;
         
         // Move constructor to avoid unnecessary copies
-        DisplayStrategy(std::vector<Candlestick>&& candlesticks) 
+        DisplayStrategy(CandlestickSeries&& candlesticks) 
             : data(std::move(candlesticks)), wasSampled(false), wasCompressed(false), compressionLevel("Standard") {}
         
         DisplayStrategy() : wasSampled(false), wasCompressed(false), compressionLevel("Standard") {}
     };
 
     // Forward declarations for helper functions
-    void printXAxisLabels(const std::vector<Candlestick>&, TimeFrame, const PlotConfiguration&);
-    std::string formatDateLabel(const std::string& date, TimeFrame timeframe);
+    void printXAxisLabels(const CandlestickSeries&, TimeFrame, const PlotConfiguration&);
+    std::string formatDateLabel(const DateTime& date, TimeFrame timeframe);
     
     /**
      *  Determines the optimal display strategy combining sampling and compression.
      */
-    DisplayStrategy determineDisplayStrategy(const std::vector<Candlestick>& candlesticks, TimeFrame timeframe) {
+    DisplayStrategy determineDisplayStrategy(const CandlestickSeries& candlesticks, TimeFrame timeframe) {
         if (candlesticks.empty()) {
             DisplayStrategy strategy;
             strategy.config = PlotConfiguration(5, 2);
@@ -74,12 +75,17 @@ namespace {
         
         // Only create strategy with data copy if sampling is needed
         if (needsSampling) {
-            std::vector<Candlestick> sampled;
+            CandlestickSeries sampled(candlesticks.timeframe());
             sampled.reserve(targetSize);
             
+            // Rows of one series have strictly increasing periods, so push_back
+            // accepts every sample as long as no index is taken twice
+            size_t previousIndex = dataSize;
             for (size_t i = 0; i < targetSize; ++i) {
                 size_t index = (i * (dataSize - 1)) / (targetSize - 1);
-                sampled.emplace_back(candlesticks[index]);
+                if (index == previousIndex) continue;
+                previousIndex = index;
+                sampled.push_back(candlesticks[index]);
             }
             
             DisplayStrategy strategy(std::move(sampled));
@@ -105,12 +111,9 @@ namespace {
             
             return strategy;
         } else {
-            // No sampling needed, create strategy with reference to original data
+            // No sampling needed; the strategy shares the caller's buffer (no row copy)
             DisplayStrategy strategy;
-            strategy.data.reserve(candlesticks.size());
-            for (const auto& candle : candlesticks) {
-                strategy.data.emplace_back(candle);
-            }
+            strategy.data = candlesticks;
             
             // Find the best compression level that fits the screen width
             int finalCompressionLevel = startCompressionLevel;
@@ -136,7 +139,7 @@ namespace {
     /**
      *  Prints an intelligent X-axis with labels at reasonable intervals.
      */
-    void printXAxisLabels(const std::vector<Candlestick>& candlesticks, TimeFrame timeframe, const PlotConfiguration& config) {
+    void printXAxisLabels(const CandlestickSeries& candlesticks, TimeFrame timeframe, const PlotConfiguration& config) {
         const int candleCharacterWidth = config.candleWidth + config.candleSpacing;
         if (candlesticks.empty() || candleCharacterWidth == 0) {
             std::cout << std::string(Constants::Y_AXIS_WIDTH, '-') << "\n\n";
@@ -153,14 +156,15 @@ namespace {
         
         const int labelInterval = std::max(1, static_cast<int>(candlesticks.size() -1) / (maxLabels -1));
         
-        for (size_t i = 0; i < candlesticks.size(); ++i) {
+        for (const auto& candle : candlesticks) {
+            const size_t i = candle.index();
             // Determine if a label should be printed at this position
             bool isFirst = (i == 0);
             bool isLast = (i == candlesticks.size() - 1);
             bool atInterval = (labelInterval > 0 && i % labelInterval == 0);
 
             if (isFirst || isLast || atInterval) {
-                std::string label = formatDateLabel(candlesticks[i].getDate(), timeframe);
+                std::string label = formatDateLabel(candle.getDateTime(), timeframe);
                 label = label.substr(0, candleCharacterWidth); // Truncate label to fit
                 std::cout << std::left << std::setw(candleCharacterWidth) << label;
             } else {
@@ -172,39 +176,72 @@ namespace {
     }
     
     /**
-     *  Formats a date string into a readable label based on the timeframe.
+     *  Formats a candle's period start into a readable label based on the timeframe.
+     * Only the digits the label needs are produced; no full date string is built.
      */
-    std::string formatDateLabel(const std::string& date, TimeFrame timeframe) {
-        if (date.length() < 10) return date;
-        
-        std::string year = date.substr(0, 4);
-        std::string month = date.substr(5, 2);
-        std::string day = date.substr(8, 2);
-        std::string shortYear = date.substr(2, 2);
-        
-        const std::string monthNames[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+    std::string formatDateLabel(const DateTime& date, TimeFrame timeframe) {
+        const int shortYear = date.year % 100;
         
-        try {
-            int monthNum = std::stoi(month);
-            if (monthNum >= 1 && monthNum <= 12) {
-                switch (timeframe) {
-                    case TimeFrame::Daily:   
-                        // Show actual day for daily timeframe
-                        return day + "/" + month;  // e.g., "15/03" instead of "Mar'24"
-                    case TimeFrame::Monthly: 
-                        return monthNames[monthNum - 1] + " " + shortYear;
-                    case TimeFrame::Yearly:  
-                        return "'" + shortYear;
+        // Labels are written straight into a small buffer
+        char buffer[8];
+        if (date.month >= 1 && date.month <= 12) {
+            switch (timeframe) {
+                case TimeFrame::Daily:   
+                    // Show actual day for daily timeframe, e.g. "15/03" instead of "Mar'24"
+                    DateTime::writeDigits(buffer, date.day, 2);
+                    buffer[2] = '/';
+                    DateTime::writeDigits(buffer + 3, date.month, 2);
+                    return std::string(buffer, 5);
+                case TimeFrame::Weekly:
+                    // ISO week and week-numbering year, e.g. "W07 24"
+                    buffer[0] = 'W';
+                    DateTime::writeDigits(buffer + 1, date.isoWeek(), 2);
+                    buffer[3] = ' ';
+                    DateTime::writeDigits(buffer + 4, date.isoWeekYear() % 100, 2);
+                    return std::string(buffer, 6);
+                case TimeFrame::Monthly: {
+                    const char* monthName = DateTime::monthAbbreviation(date.month);
+                    std::copy(monthName, monthName + 3, buffer);
+                    buffer[3] = ' ';
+                    DateTime::writeDigits(buffer + 4, shortYear, 2);
+                    return std::string(buffer, 6);
                 }
+                case TimeFrame::Quarterly:
+                    // e.g. "Q1 24"
+                    buffer[0] = 'Q';
+                    buffer[1] = static_cast<char>('1' + (date.month - 1) / 3);
+                    buffer[2] = ' ';
+                    DateTime::writeDigits(buffer + 3, shortYear, 2);
+                    return std::string(buffer, 5);
+                case TimeFrame::Seasonal: {
+                    // e.g. "DJF 24" for the winter from December 2023
+                    const int32_t season = TimeGrid::periodIndex(date, timeframe);
+                    const char* seasonName = TimeGrid::seasonAbbreviation(season);
+                    std::copy(seasonName, seasonName + 3, buffer);
+                    buffer[3] = ' ';
+                    DateTime::writeDigits(buffer + 4, TimeGrid::periodYear(season, timeframe) % 100, 2);
+                    return std::string(buffer, 6);
+                }
+                case TimeFrame::Yearly:  
+                    buffer[0] = '\'';
+                    DateTime::writeDigits(buffer + 1, shortYear, 2);
+                    return std::string(buffer, 3);
+                case TimeFrame::HourOfDay:
+                    // e.g. "13h"
+                    DateTime::writeDigits(buffer, date.hour, 2);
+                    buffer[2] = 'h';
+                    return std::string(buffer, 3);
             }
-        } catch (...) { /* Fallback below */ }
+        }
         
         // Fallback to numeric format if something fails
-        return date.substr(0, 7);
+        char fallback[10];
+        date.formatDate(fallback);
+        return std::string(fallback, 7);
     }
 
 
-    std::string getCandlestickAtRow(const Candlestick& candle, double rowTemp, double tempPerRow, const PlotConfiguration& config) {
+    std::string getCandlestickAtRow(const CandlestickSeries::Row& candle, double rowTemp, double tempPerRow, const PlotConfiguration& config) {
         double high = candle.getHigh();
         double low = candle.getLow();
         double open = candle.getOpen();
@@ -225,22 +262,24 @@ namespace {
         return config.emptySpace;
     }
 
-    // Optimized to find both min and max in single pass
-    std::pair<double, double> findTemperatureRange(const std::vector<Candlestick>& candlesticks) {
+    // Optimized to find both min and max in single pass over the low and high columns
+    std::pair<double, double> findTemperatureRange(const CandlestickSeries& candlesticks) {
         if (candlesticks.empty()) return {0.0, 0.0};
         
-        double minTemp = candlesticks[0].getLow();
-        double maxTemp = candlesticks[0].getHigh();
+        const double* lows = candlesticks.lows().data();
+        const double* highs = candlesticks.highs().data();
+        double minTemp = lows[0];
+        double maxTemp = highs[0];
         
-        for (const auto& candle : candlesticks) {
-            minTemp = std::min(minTemp, candle.getLow());
-            maxTemp = std::max(maxTemp, candle.getHigh());
+        for (size_t i = 0; i < candlesticks.size(); ++i) {
+            minTemp = std::min(minTemp, lows[i]);
+            maxTemp = std::max(maxTemp, highs[i]);
         }
         
         return {minTemp, maxTemp};
     }
 
-    void printSummary(const std::vector<Candlestick>& candlesticks) {
+    void printSummary(const CandlestickSeries& candlesticks) {
         if (candlesticks.empty()) return;
         
         int upCount = 0;
@@ -265,7 +304,7 @@ namespace {
 
 namespace Plotter {
 
-void plotCandlesticks(const std::vector<Candlestick>& candlesticks, TimeFrame timeframe, int chartHeight) {
+void plotCandlesticks(const CandlestickSeries& candlesticks, TimeFrame timeframe, int chartHeight) {
     if (candlesticks.empty()) {
         std::cout << "No candlestick data to plot.\n";
         return;
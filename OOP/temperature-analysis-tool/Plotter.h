@@ -3,22 +3,22 @@
 
 #include <vector>
 #include <string>
-#include "Candlestick.h"
+#include "CandlestickSeries.h"
 #include "Common.h"
 #include "PlotConfiguration.h"
 //self written code start
 namespace Plotter {
     /**
-     *  Plots a vector of Candlestick data to the console.
+     *  Plots a series of Candlestick data to the console.
      * * This function handles the entire process of rendering the chart, including
      * intelligent sampling of data, optimal compression for display, and printing
      * the Y-axis, X-axis, and a summary.
-     * * @param candlesticks The vector of Candlestick objects to plot.
+     * * @param candlesticks The candlestick series to plot.
      * @param timeframe The timeframe (Daily, Monthly, Yearly) of the data.
      * @param chartHeight The desired height of the chart in character rows.
      */
     void plotCandlesticks(
-        const std::vector<Candlestick>& candlesticks, 
+        const CandlestickSeries& candlesticks, 
         TimeFrame timeframe, 
         int chartHeight = 20
     );
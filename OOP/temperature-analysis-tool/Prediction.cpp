@@ -1,63 +1,94 @@
 #include "Prediction.h"
 #include "PredictionDisplay.h"
 #include "Common.h"
+#include "TimeGrid.h"
 #include <cmath>
 #include <algorithm>
 #include <numeric>
 #include <sstream>
 #include <iomanip>
 
+//self written code start
+std::string PredictionResult::modelName() const {
+    switch (model) {
+        case PredictionModel::MovingAverage:
+            return "Moving Average (" + std::to_string(modelParameter) + "-period)";
+        case PredictionModel::Heuristic:
+            return "Heuristic (Momentum)";
+        case PredictionModel::LinearRegression:
+        default:
+            return "Linear Regression";
+    }
+}
+
+std::string PredictionResult::confidenceDescription() const {
+    const auto metric = [this](const char* name, const char* meaning) {
+        std::ostringstream oss;
+        oss << name << " = " << std::fixed << std::setprecision(3) << confidenceMetric << " (" << meaning << ")";
+        return oss.str();
+    };
+    
+    switch (confidenceMeasure) {
+        case ConfidenceMeasure::NoLinearTrend: return "R² = 0.0 (no linear trend detected)";
+        case ConfidenceMeasure::RSquared:      return metric("R²", "coefficient of determination");
+        case ConfidenceMeasure::Stability:     return metric("Stability", "inverse volatility metric");
+        case ConfidenceMeasure::SinglePoint:   return "Single data point (no momentum available)";
+        case ConfidenceMeasure::Consistency:   return metric("Consistency", "trend reliability metric");
+        case ConfidenceMeasure::None:
+        default:                               return "";
+    }
+}
+//self written code end
+
 // Core prediction algorithm
 /*self written code start (code built with reference to : 
     https://github.com/NumericalMax/Linear-Regression)
     https://www.geeksforgeeks.org/regression-analysis-and-the-best-fitting-line-using-c/
 */
 
-PredictionResult Prediction::predictLinearWithConfidence(const std::vector<Candlestick>& data) {
-    const std::string modelName = "Linear Regression";
+PredictionResult Prediction::predictLinearWithConfidence(const CandlestickSeries& data) {
+    constexpr PredictionModel model = PredictionModel::LinearRegression;
     std::string errorMessage;
     
     if (!validateDataSize(data, Constants::MIN_LINEAR_DATA_SIZE, errorMessage)) {
-        return PredictionResult(errorMessage, modelName);
+        return PredictionResult(errorMessage, model);
     }
     
     const auto n = static_cast<double>(data.size());
     double sumX = 0.0, sumY = 0.0, sumXY = 0.0, sumX2 = 0.0;
     
-    // Calculate sums for least squares method
-    for (size_t i = 0; i < data.size(); ++i) {
-        const double x = static_cast<double>(i);
-        const double y = data[i].getClose();
+    // Calculate sums for least squares method. x is the candle's slot on the
+    // time grid, so periods with no candle widen the x axis instead of being
+    // silently closed up; only the close column is read.
+    const double* closes = data.closes().data();
+    data.forEachSlot([&](size_t i, size_t slot) {
+        const double x = static_cast<double>(slot);
+        const double y = closes[i];
         
         sumX += x;
         sumY += y;
         sumXY += x * y;
         sumX2 += x * x;
-    }
+    });
     
     // Calculate slope and intercept
     const double denominator = n * sumX2 - sumX * sumX;
     if (std::abs(denominator) < Constants::EPSILON) {
         const double prediction = sumY / n;
-        const std::string confDesc = "R² = 0.0 (no linear trend detected)";
-        return PredictionResult(prediction, 0.0, modelName, confDesc);
+        return PredictionResult(prediction, 0.0, model, ConfidenceMeasure::NoLinearTrend);
     }
     
     const double slope = (n * sumXY - sumX * sumY) / denominator;
     const double intercept = (sumY - slope * sumX) / n;
     
-    // Calculate prediction for next period
-    const double nextX = n;
+    // Calculate prediction for the period after the last candle
+    const double nextX = static_cast<double>(data.slotCount());
     const double prediction = slope * nextX + intercept;
     
     // Calculate confidence metric (R²)
     const double rSquared = calculateRSquaredDetailed(data, slope, intercept);
     
-    std::ostringstream confDesc;
-    confDesc << "R² = " << std::fixed << std::setprecision(3) << rSquared 
-             << " (coefficient of determination)";
-    
-    return PredictionResult(prediction, rSquared, modelName, confDesc.str());
+    return PredictionResult(prediction, rSquared, model, ConfidenceMeasure::RSquared);
 }
 // self written code end
 
@@ -65,19 +96,18 @@ PredictionResult Prediction::predictLinearWithConfidence(const std::vector<Candl
     https://www.youtube.com/watch?v=6vH3NFcpr3w
 */
 PredictionResult Prediction::predictMovingAverageWithConfidence(
-    const std::vector<Candlestick>& data, int windowSize) {
+    const CandlestickSeries& data, int windowSize) {
     
-    std::ostringstream modelNameStream;
-    modelNameStream << "Moving Average (" << windowSize << "-period)";
-    const std::string modelName = modelNameStream.str();
+    // The window is filled into the name only when it is displayed
+    constexpr PredictionModel model = PredictionModel::MovingAverage;
     std::string errorMessage;
     
     if (!validateDataSize(data, Constants::MIN_MOVING_AVERAGE_DATA_SIZE, errorMessage)) {
-        return PredictionResult(errorMessage, modelName);
+        return PredictionResult(errorMessage, model, windowSize);
     }
     
     if (!validateWindowSize(windowSize, data.size(), errorMessage)) {
-        return PredictionResult(errorMessage, modelName);
+        return PredictionResult(errorMessage, model, windowSize);
     }
     
     const int actualWindowSize = std::min(windowSize, static_cast<int>(data.size()));
@@ -85,38 +115,30 @@ PredictionResult Prediction::predictMovingAverageWithConfidence(
     
     // Calculate moving average prediction
     const double sum = std::accumulate(
-        data.begin() + startIdx, data.end(), 0.0,
-        [](double acc, const Candlestick& candle) {
-            return acc + candle.getClose();
-        });
+        data.closes().begin() + startIdx, data.closes().end(), 0.0);
     
     const double prediction = sum / actualWindowSize;
     
     // Calculate stability confidence metric
     const double stabilityConfidence = calculateStabilityConfidence(data, actualWindowSize);
     
-    std::ostringstream confDesc;
-    confDesc << "Stability = " << std::fixed << std::setprecision(3) << stabilityConfidence
-             << " (inverse volatility metric)";
-    
-    return PredictionResult(prediction, stabilityConfidence, modelName, confDesc.str());
+    return PredictionResult(prediction, stabilityConfidence, model, ConfidenceMeasure::Stability, windowSize);
 }
 //self written code end
 
 /*self written code start (code built with reference to :
     *https://github.com/MisaghMomeniB/Stock-Momentum-Analysis
 */
-PredictionResult Prediction::predictHeuristicWithConfidence(const std::vector<Candlestick>& data) {
-    const std::string modelName = "Heuristic (Momentum)";
+PredictionResult Prediction::predictHeuristicWithConfidence(const CandlestickSeries& data) {
+    constexpr PredictionModel model = PredictionModel::Heuristic;
     std::string errorMessage;
     
     if (!validateDataSize(data, Constants::MIN_HEURISTIC_DATA_SIZE, errorMessage)) {
-        return PredictionResult(errorMessage, modelName);
+        return PredictionResult(errorMessage, model);
     }
     
     if (data.size() == 1) {
-        const std::string confDesc = "Single data point (no momentum available)";
-        return PredictionResult(data[0].getClose(), 0.0, modelName, confDesc);
+        return PredictionResult(data[0].getClose(), 0.0, model, ConfidenceMeasure::SinglePoint);
     }
     
     // Calculate momentum prediction
@@ -128,15 +150,11 @@ PredictionResult Prediction::predictHeuristicWithConfidence(const std::vector<Ca
     // Calculate consistency confidence metric
     const double consistencyConfidence = calculateConsistencyConfidence(data);
     
-    std::ostringstream confDesc;
-    confDesc << "Consistency = " << std::fixed << std::setprecision(3) << consistencyConfidence
-             << " (trend reliability metric)";
-    
-    return PredictionResult(prediction, consistencyConfidence, modelName, confDesc.str());
+    return PredictionResult(prediction, consistencyConfidence, model, ConfidenceMeasure::Consistency);
 }
 
 void Prediction::displayPredictionResults(
-    const std::vector<Candlestick>& data,
+    const CandlestickSeries& data,
     TimeFrame timeframe,
     std::string_view country,
     int startYear, int endYear,
@@ -149,28 +167,26 @@ void Prediction::displayPredictionResults(
 //self written code start
 // Private helper methods
 double Prediction::calculateRSquaredDetailed(
-    const std::vector<Candlestick>& data, 
+    const CandlestickSeries& data, 
     double slope, double intercept) noexcept {
     
     if (data.size() < Constants::MIN_LINEAR_DATA_SIZE) return 0.0;
     
     // Calculate mean efficiently
-    const double sumY = std::accumulate(data.begin(), data.end(), 0.0,
-        [](double acc, const Candlestick& candle) {
-            return acc + candle.getClose();
-        });
+    const auto& closes = data.closes();
+    const double sumY = std::accumulate(closes.begin(), closes.end(), 0.0);
     const double meanY = sumY / data.size();
     
     double totalSumSquares = 0.0;
     double residualSumSquares = 0.0;
     
-    for (size_t i = 0; i < data.size(); ++i) {
-        const double actualY = data[i].getClose();
-        const double predictedY = slope * static_cast<double>(i) + intercept;
+    data.forEachSlot([&](size_t i, size_t slot) {
+        const double actualY = closes[i];
+        const double predictedY = slope * static_cast<double>(slot) + intercept;
         
         totalSumSquares += std::pow(actualY - meanY, 2);
         residualSumSquares += std::pow(actualY - predictedY, 2);
-    }
+    });
     
     if (totalSumSquares < Constants::EPSILON) return 0.0;
     
@@ -179,18 +195,14 @@ double Prediction::calculateRSquaredDetailed(
 }
 
 double Prediction::calculateStabilityConfidence(
-    const std::vector<Candlestick>& data, 
+    const CandlestickSeries& data, 
     int windowSize) noexcept {
     
     if (data.size() < Constants::MIN_MOVING_AVERAGE_DATA_SIZE || windowSize < 2) return 0.0;
     
-    const auto start = std::max(0, static_cast<int>(data.size()) - windowSize);
-    std::vector<double> recentValues;
-    recentValues.reserve(windowSize);
-    
-    for (int i = start; i < static_cast<int>(data.size()); ++i) {
-        recentValues.push_back(data[i].getClose());
-    }
+    // The window is read in place from the close column
+    const auto start = static_cast<size_t>(std::max(0, static_cast<int>(data.size()) - windowSize));
+    const CandlestickSeries::Column recentValues(data.closes().data() + start, data.size() - start);
     
     if (recentValues.size() < Constants::MIN_MOVING_AVERAGE_DATA_SIZE) return 0.0;
     
@@ -203,20 +215,27 @@ double Prediction::calculateStabilityConfidence(
     return std::max(0.0, std::min(stabilityConfidence, 1.0));
 }
 
-double Prediction::calculateConsistencyConfidence(const std::vector<Candlestick>& data) noexcept {
+double Prediction::calculateConsistencyConfidence(const CandlestickSeries& data) noexcept {
     if (data.size() < 3) return 0.0;
     
-    std::vector<double> changes;
-    changes.reserve(data.size() - 1);
+    // Period-to-period changes are recomputed on each pass rather than stored,
+    // so the rolling loops that call this per period do not allocate
+    const size_t changeCount = data.size() - 1;
+    if (changeCount < Constants::MIN_MOVING_AVERAGE_DATA_SIZE) return 0.0;
     
+    const double* closes = data.closes().data();
+    double changeSum = 0.0;
     for (size_t i = 1; i < data.size(); ++i) {
-        changes.push_back(data[i].getClose() - data[i-1].getClose());
+        changeSum += closes[i] - closes[i-1];
     }
+    const double changeMean = changeSum / changeCount;
     
-    if (changes.size() < Constants::MIN_MOVING_AVERAGE_DATA_SIZE) return 0.0;
-    
-    const double changeMean = calculateMean(changes);
-    const double changeStdDev = calculateStandardDeviation(changes, changeMean);
+    double sumSquaredDiffs = 0.0;
+    for (size_t i = 1; i < data.size(); ++i) {
+        const double diff = (closes[i] - closes[i-1]) - changeMean;
+        sumSquaredDiffs += diff * diff;
+    }
+    const double changeStdDev = std::sqrt(sumSquaredDiffs / (changeCount - 1));
     
     const double changeVariability = changeStdDev / (std::abs(changeMean) + 1.0);
     const double consistencyConfidence = 1.0 / (1.0 + changeVariability);
@@ -226,7 +245,7 @@ double Prediction::calculateConsistencyConfidence(const std::vector<Candlestick>
 // self written code end
 
 bool Prediction::validateDataSize(
-    const std::vector<Candlestick>& data, 
+    const CandlestickSeries& data, 
     size_t minSize, 
     std::string& errorMessage) noexcept {
     
@@ -271,7 +290,7 @@ std::string Prediction::getConfidenceLevel(double confidence) noexcept {
 
 //self written code start
 std::string Prediction::determineNextPeriod(
-    const std::vector<Candlestick>& data, 
+    const CandlestickSeries& data, 
     TimeFrame timeframe, int endYear) {
     
     if (data.empty()) return "Unknown";
@@ -281,10 +300,10 @@ std::string Prediction::determineNextPeriod(
             return std::to_string(endYear + 1);
             
         case TimeFrame::Monthly: {
-            const std::string& lastDate = data.back().getDate();
-            if (lastDate.length() >= 7) {
-                const int year = std::stoi(lastDate.substr(0, 4));
-                const int month = std::stoi(lastDate.substr(5, 2));
+            if (data.back().getDateKey() != 0) {
+                const DateTime lastDate = data.back().getDateTime();
+                const int year = lastDate.year;
+                const int month = lastDate.month;
                 
                 if (month == 12) {
                     return std::to_string(year + 1) + "-01 (January " + std::to_string(year + 1) + ")";
@@ -300,6 +319,33 @@ std::string Prediction::determineNextPeriod(
         case TimeFrame::Daily:
             return "Next day";
             
+        case TimeFrame::Weekly: {
+            // The period after the last one on the grid, e.g. "2024-W08"
+            const DateTime next = TimeGrid::periodStart(data.back().getPeriod() + 1, timeframe);
+            std::ostringstream oss;
+            oss << next.isoWeekYear() << "-W" << std::setfill('0') << std::setw(2) << next.isoWeek();
+            return oss.str();
+        }
+            
+        case TimeFrame::Quarterly: {
+            const int32_t next = data.back().getPeriod() + 1;
+            return std::to_string(TimeGrid::periodYear(next, timeframe)) + "-Q" +
+                   std::to_string(next - TimeGrid::floorDivide(next, 4) * 4 + 1);
+        }
+            
+        case TimeFrame::Seasonal: {
+            const int32_t next = data.back().getPeriod() + 1;
+            return std::string(TimeGrid::seasonAbbreviation(next)) + " " +
+                   std::to_string(TimeGrid::periodYear(next, timeframe));
+        }
+            
+        case TimeFrame::HourOfDay: {
+            // The profile wraps around after the last hour of the day
+            std::ostringstream oss;
+            oss << std::setfill('0') << std::setw(2) << (data.back().getPeriod() + 1) % 24 << ":00";
+            return oss.str();
+        }
+            
         default:
             return "Next period";
     }
@@ -5,30 +5,58 @@
 #include <string>
 #include <functional>
 #include <string_view>
-#include "Candlestick.h"
+#include <cmath>
+#include "CandlestickSeries.h"
 #include "Common.h"
 
 //self written code start
+/**
+ * Prediction models, named by PredictionResult::modelName()
+ */
+enum class PredictionModel {
+    LinearRegression,
+    MovingAverage,  // modelParameter holds the window size
+    Heuristic
+};
+
+/**
+ * What a result's confidenceMetric measures, described by
+ * PredictionResult::confidenceDescription()
+ */
+enum class ConfidenceMeasure {
+    None,
+    NoLinearTrend,
+    RSquared,
+    Stability,
+    SinglePoint,
+    Consistency
+};
+
 /**
  * Structure to hold prediction results with confidence metrics
+ *
+ * The model and the confidence measure are kept as enums and only turned
+ * into text when displayed, so producing a result (as the rolling and
+ * validation loops do once per period) allocates nothing.
  */
 struct PredictionResult {
     double predictionValue{0.0};
     double confidenceMetric{0.0};
-    std::string modelName;
     bool isValid{false};
     std::string errorMessage;
-    std::string confidenceDescription;
+    PredictionModel model{PredictionModel::LinearRegression};
+    int modelParameter{0};
+    ConfidenceMeasure confidenceMeasure{ConfidenceMeasure::None};
     
     // Constructor for successful prediction
-    PredictionResult(double prediction, double confidence, std::string_view name, 
-                    std::string_view confDesc = "") 
-        : predictionValue(prediction), confidenceMetric(confidence), modelName(name),
-          isValid(true), confidenceDescription(confDesc) {}
+    PredictionResult(double prediction, double confidence, PredictionModel predictionModel,
+                    ConfidenceMeasure measure = ConfidenceMeasure::None, int parameter = 0) 
+        : predictionValue(prediction), confidenceMetric(confidence), isValid(true),
+          model(predictionModel), modelParameter(parameter), confidenceMeasure(measure) {}
     
     // Constructor for failed prediction
-    PredictionResult(std::string_view error, std::string_view name)
-        : modelName(name), isValid(false), errorMessage(error) {}
+    PredictionResult(std::string_view error, PredictionModel predictionModel, int parameter = 0)
+        : isValid(false), errorMessage(error), model(predictionModel), modelParameter(parameter) {}
     
     // Default constructors
     PredictionResult() = default;
@@ -36,6 +64,9 @@ struct PredictionResult {
     PredictionResult& operator=(const PredictionResult&) = default;
     PredictionResult(PredictionResult&&) = default;
     PredictionResult& operator=(PredictionResult&&) = default;
+
+    std::string modelName() const;
+    std::string confidenceDescription() const;
 };
 
 /**
@@ -53,13 +84,13 @@ struct PredictionConfig {
 class Prediction {
 public:
     // Main prediction methods
-    static PredictionResult predictLinearWithConfidence(const std::vector<Candlestick>& data);
-    static PredictionResult predictMovingAverageWithConfidence(const std::vector<Candlestick>& data, int windowSize = 3);
-    static PredictionResult predictHeuristicWithConfidence(const std::vector<Candlestick>& data);
+    static PredictionResult predictLinearWithConfidence(const CandlestickSeries& data);
+    static PredictionResult predictMovingAverageWithConfidence(const CandlestickSeries& data, int windowSize = 3);
+    static PredictionResult predictHeuristicWithConfidence(const CandlestickSeries& data);
 
     // Main display method
     static void displayPredictionResults(
-        const std::vector<Candlestick>& data,
+        const CandlestickSeries& data,
         TimeFrame timeframe,
         std::string_view country,
         int startYear, int endYear,
@@ -67,13 +98,13 @@ public:
     );
     // Utility methods
     static std::string getConfidenceLevel(double confidence) noexcept;
-    static std::string determineNextPeriod(const std::vector<Candlestick>& data, TimeFrame timeframe, int endYear);
+    static std::string determineNextPeriod(const CandlestickSeries& data, TimeFrame timeframe, int endYear);
 
 private:
     // Statistical calculation methods
-    static double calculateRSquaredDetailed(const std::vector<Candlestick>& data, double slope, double intercept) noexcept;
-    static double calculateStabilityConfidence(const std::vector<Candlestick>& data, int windowSize) noexcept;
-    static double calculateConsistencyConfidence(const std::vector<Candlestick>& data) noexcept;
+    static double calculateRSquaredDetailed(const CandlestickSeries& data, double slope, double intercept) noexcept;
+    static double calculateStabilityConfidence(const CandlestickSeries& data, int windowSize) noexcept;
+    static double calculateConsistencyConfidence(const CandlestickSeries& data) noexcept;
 
     // Statistical utilities
     template<typename Container>
@@ -83,7 +114,7 @@ private:
     static double calculateStandardDeviation(const Container& values, double mean) noexcept;
 
     // Input validation
-    static bool validateDataSize(const std::vector<Candlestick>& data, size_t minSize, std::string& errorMessage) noexcept;
+    static bool validateDataSize(const CandlestickSeries& data, size_t minSize, std::string& errorMessage) noexcept;
     static bool validateWindowSize(int windowSize, size_t dataSize, std::string& errorMessage) noexcept;
 };
 
@@ -1,5 +1,6 @@
 #include "PredictionChart.h"
 #include "Prediction.h"
+#include "TimeGrid.h"
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
@@ -11,7 +12,7 @@
 */
 //! TDL Output looks messy, replace txt with ANSI codes for better readability
 void PredictionChart::displayVerticalChart(
-    const std::vector<Candlestick>& data,
+    const CandlestickSeries& data,
     TimeFrame timeframe,
     std::string_view country,
     int startYear, int endYear) {
@@ -30,14 +31,14 @@ void PredictionChart::displayVerticalChart(
     const auto allPredictions = generateAllRollingPredictions(data);
     
     // Display the vertical chart
-    displayChart(data, allPredictions, timeframe, startYear);
+    displayChart(data, allPredictions, timeframe);
     
     // Display chart footer and accuracy analysis
     displayChartFooter();
     displayAccuracyAnalysis(data, allPredictions);
 }
 
-void PredictionChart::displayChartHeader(const std::vector<Candlestick>& data, std::string_view country, 
+void PredictionChart::displayChartHeader(const CandlestickSeries& data, std::string_view country, 
                                         int startYear, int endYear) {
     std::cout << "\n" << std::string(Constants::SECTION_SEPARATOR_WIDTH_60, '=') << "\n";
     std::cout << "PREDICTION COMPARISON CHART\n";
@@ -46,9 +47,9 @@ void PredictionChart::displayChartHeader(const std::vector<Candlestick>& data, s
     std::cout << "Showing up to " << Constants::VERTICAL_CHART_MAX_PERIODS << " periods for optimal readability\n\n";
 }
 
-void PredictionChart::displayChart(const std::vector<Candlestick>& data, 
+void PredictionChart::displayChart(const CandlestickSeries& data, 
                                  const std::vector<std::vector<PredictionResult>>& allPredictions,
-                                 TimeFrame timeframe, int startYear) {
+                                 TimeFrame timeframe) {
     
     // Calculate temperature range
     double minTemp, maxTemp;
@@ -86,9 +87,13 @@ void PredictionChart::displayChart(const std::vector<Candlestick>& data,
     }
     std::cout << "\n        ";
     
-    // Period labels at intervals
+    // Period labels at intervals, taken from each candle's own period so
+    // gaps in the data do not shift them
+    DateTime previousLabel;
     for (size_t i = 0; i < maxPeriods; i += Constants::PERIOD_LABEL_INTERVAL) {
-        std::string label = formatPeriodLabel(i, timeframe, startYear);
+        const DateTime date = data[i].getDateTime();
+        std::string label = formatPeriodLabel(date, timeframe, i == 0 ? nullptr : &previousLabel);
+        previousLabel = date;
         std::cout << std::left << std::setw(Constants::PERIOD_LABEL_INTERVAL) 
                   << label.substr(0, Constants::PERIOD_LABEL_MAX_LENGTH);
     }
@@ -102,7 +107,7 @@ void PredictionChart::displayChartFooter() {
     std::cout << "  * = Prediction matches actual  x = Multiple predictions\n\n";
 }
 
-void PredictionChart::displayAccuracyAnalysis(const std::vector<Candlestick>& data,
+void PredictionChart::displayAccuracyAnalysis(const CandlestickSeries& data,
                                              const std::vector<std::vector<PredictionResult>>& allPredictions) {
     
     std::cout << "=== PREDICTION ACCURACY ANALYSIS ===\n";
@@ -175,9 +180,9 @@ void PredictionChart::displayAccuracyAnalysis(const std::vector<Candlestick>& da
 // Helper methods
 
 std::vector<std::vector<PredictionResult>> PredictionChart::generateAllRollingPredictions(
-    const std::vector<Candlestick>& data) {
+    const CandlestickSeries& data) {
     
-    const std::vector<std::pair<std::function<PredictionResult(const std::vector<Candlestick>&)>, int>> models = {
+    const std::vector<std::pair<std::function<PredictionResult(const CandlestickSeries&)>, int>> models = {
         {[](const auto& d) { return Prediction::predictLinearWithConfidence(d); }, 
          static_cast<int>(Constants::MIN_LINEAR_DATA_SIZE)},
         {[](const auto& d) { return Prediction::predictMovingAverageWithConfidence(d, 3); }, 
@@ -197,22 +202,22 @@ std::vector<std::vector<PredictionResult>> PredictionChart::generateAllRollingPr
 }
 
 std::vector<PredictionResult> PredictionChart::generateRollingPredictions(
-    const std::vector<Candlestick>& data,
-    const std::function<PredictionResult(const std::vector<Candlestick>&)>& modelFunction,
+    const CandlestickSeries& data,
+    const std::function<PredictionResult(const CandlestickSeries&)>& modelFunction,
     int startIndex) {
     
     std::vector<PredictionResult> predictions;
     predictions.reserve(data.size() - startIndex);
     
+    // Each training window is a view of the rows before i; nothing is copied
     for (size_t i = startIndex; i < data.size(); ++i) {
-        const std::vector<Candlestick> trainingData(data.begin(), data.begin() + i);
-        predictions.push_back(modelFunction(trainingData));
+        predictions.push_back(modelFunction(CandlestickSeries(data, 0, i)));
     }
     
     return predictions;
 }
 
-char PredictionChart::getSymbolAtPosition(const std::vector<Candlestick>& data,
+char PredictionChart::getSymbolAtPosition(const CandlestickSeries& data,
                                          const std::vector<std::vector<PredictionResult>>& allPredictions,
                                          size_t periodIndex, double currentTemp, double tempPerRow) {
     
@@ -272,7 +277,7 @@ char PredictionChart::getSymbolAtPosition(const std::vector<Candlestick>& data,
     }
 }
 
-void PredictionChart::calculateTemperatureRange(const std::vector<Candlestick>& data,
+void PredictionChart::calculateTemperatureRange(const CandlestickSeries& data,
                                                const std::vector<std::vector<PredictionResult>>& allPredictions,
                                                double& minTemp, double& maxTemp) {
     
@@ -303,27 +308,45 @@ void PredictionChart::calculateTemperatureRange(const std::vector<Candlestick>&
     maxTemp += padding;
 }
 
-std::string PredictionChart::formatPeriodLabel(size_t index, TimeFrame timeframe, int startYear) {
+std::string PredictionChart::formatPeriodLabel(const DateTime& date, TimeFrame timeframe,
+                                               const DateTime* previousLabel) {
+    // A label names the coarser unit whenever it changed since the previous label
+    const bool newYear = previousLabel == nullptr || previousLabel->year != date.year;
+    const bool newMonth = newYear || previousLabel->month != date.month;
+    
     switch (timeframe) {
-        case TimeFrame::Yearly:
-            return std::to_string(startYear + static_cast<int>(index));
-            
-        case TimeFrame::Monthly: {
-            int year = startYear + static_cast<int>(index / 12);
-            int month = static_cast<int>(index % 12) + 1;
-            std::ostringstream oss;
-            oss << year << "-" << std::setfill('0') << std::setw(2) << month;
-            return oss.str();
+        case TimeFrame::Monthly:
+            return newYear ? std::to_string(date.year) : DateTime::monthAbbreviation(date.month);
+        
+        case TimeFrame::Daily:
+            return newMonth ? DateTime::monthAbbreviation(date.month) : std::to_string(date.day);
+        
+        case TimeFrame::Weekly: {
+            const bool newWeekYear = previousLabel == nullptr || previousLabel->isoWeekYear() != date.isoWeekYear();
+            char week[3] = {'W'};
+            DateTime::writeDigits(week + 1, date.isoWeek(), 2);
+            return newWeekYear ? std::to_string(date.isoWeekYear()) : std::string(week, sizeof(week));
         }
         
-        case TimeFrame::Daily: {
-            std::ostringstream oss;
-            oss << "Day" << std::setfill('0') << std::setw(3) << (index + 1);
-            return oss.str();
+        case TimeFrame::Quarterly:
+            return newYear ? std::to_string(date.year) : "Q" + std::to_string((date.month - 1) / 3 + 1);
+        
+        case TimeFrame::Seasonal: {
+            // Winters are counted in the year of their January
+            const int32_t season = TimeGrid::periodIndex(date, timeframe);
+            const bool newSeasonYear = previousLabel == nullptr ||
+                TimeGrid::periodYear(TimeGrid::periodIndex(*previousLabel, timeframe), timeframe) !=
+                TimeGrid::periodYear(season, timeframe);
+            return newSeasonYear ? std::to_string(TimeGrid::periodYear(season, timeframe))
+                                 : TimeGrid::seasonAbbreviation(season);
         }
         
+        case TimeFrame::HourOfDay:
+            return std::to_string(date.hour) + "h";
+        
+        case TimeFrame::Yearly:
         default:
-            return "P" + std::to_string(index + 1);
+            return std::to_string(date.year);
     }
 }
 
@@ -5,7 +5,7 @@
 #include <string>
 #include <string_view>
 #include "Prediction.h"
-#include "Candlestick.h"
+#include "CandlestickSeries.h"
 #include "Common.h"
 
 //self written code start
@@ -16,42 +16,48 @@ class PredictionChart {
 public:
     // Main chart display method
     static void displayVerticalChart(
-        const std::vector<Candlestick>& data,
+        const CandlestickSeries& data,
         TimeFrame timeframe,
         std::string_view country,
         int startYear, int endYear
     );
 
-private:
-    // Chart generation methods
+    // Chart generation methods (public so the allocation tests can drive them)
     static std::vector<std::vector<PredictionResult>> generateAllRollingPredictions(
-        const std::vector<Candlestick>& data
+        const CandlestickSeries& data
     );
     
     static std::vector<PredictionResult> generateRollingPredictions(
-        const std::vector<Candlestick>& data,
-        const std::function<PredictionResult(const std::vector<Candlestick>&)>& modelFunction,
+        const CandlestickSeries& data,
+        const std::function<PredictionResult(const CandlestickSeries&)>& modelFunction,
         int startIndex
     );
 
+private:
+
     // Chart display helpers
-    static void displayChartHeader(const std::vector<Candlestick>& data, std::string_view country, 
+    static void displayChartHeader(const CandlestickSeries& data, std::string_view country, 
                                   int startYear, int endYear);
-    static void displayChart(const std::vector<Candlestick>& data, 
+    static void displayChart(const CandlestickSeries& data, 
                            const std::vector<std::vector<PredictionResult>>& allPredictions,
-                           TimeFrame timeframe, int startYear);
+                           TimeFrame timeframe);
     static void displayChartFooter();
-    static void displayAccuracyAnalysis(const std::vector<Candlestick>& data,
+    static void displayAccuracyAnalysis(const CandlestickSeries& data,
                                        const std::vector<std::vector<PredictionResult>>& allPredictions);
 
     // Chart utility methods
-    static char getSymbolAtPosition(const std::vector<Candlestick>& data,
+    static char getSymbolAtPosition(const CandlestickSeries& data,
                                    const std::vector<std::vector<PredictionResult>>& allPredictions,
                                    size_t periodIndex, double currentTemp, double tempPerRow);
-    static void calculateTemperatureRange(const std::vector<Candlestick>& data,
+    static void calculateTemperatureRange(const CandlestickSeries& data,
                                          const std::vector<std::vector<PredictionResult>>& allPredictions,
                                          double& minTemp, double& maxTemp);
-    static std::string formatPeriodLabel(size_t index, TimeFrame timeframe, int startYear);
+    /**
+     * Axis label for a period, short enough for PERIOD_LABEL_MAX_LENGTH
+     * @param previousLabel Date of the previous label, or nullptr for the first
+     */
+    static std::string formatPeriodLabel(const DateTime& date, TimeFrame timeframe,
+                                         const DateTime* previousLabel);
     
     // Statistical utilities
     template<typename Container>
@@ -9,7 +9,7 @@
 
 //self written code start
 void PredictionDisplay::displayEnhancedResults(
-    const std::vector<Candlestick>& data,
+    const CandlestickSeries& data,
     TimeFrame timeframe,
     std::string_view country,
     int startYear, int endYear,
@@ -78,12 +78,12 @@ void PredictionDisplay::displayPredictionSummary(
     for (size_t i = 0; i < results.size() && i < descriptions.size(); ++i) {
         const auto& result = results[i];
         
-        std::cout << (i + 1) << ". " << result.modelName << "\n";
+        std::cout << (i + 1) << ". " << result.modelName() << "\n";
         std::cout << "   Method: " << descriptions[i] << "\n";
         
         if (result.isValid) {
             std::cout << "   Result: " << formatTemperature(result.predictionValue) << "°C\n";
-            std::cout << "   Confidence: " << result.confidenceDescription << "\n";
+            std::cout << "   Confidence: " << result.confidenceDescription() << "\n";
             std::cout << "   Assessment: " << Prediction::getConfidenceLevel(result.confidenceMetric) << " confidence\n\n";
         } else {
             std::cout << "   Error: " << result.errorMessage << "\n\n";
@@ -109,12 +109,12 @@ void PredictionDisplay::displayPredictionTable(
     
     for (const auto& result : results) {
         if (result.isValid) {
-            std::cout << std::left << std::setw(25) << result.modelName
+            std::cout << std::left << std::setw(25) << result.modelName()
                       << std::setw(12) << (formatTemperature(result.predictionValue) + "°C")
                       << std::setw(15) << formatConfidence(result.confidenceMetric)
                       << std::setw(20) << Prediction::getConfidenceLevel(result.confidenceMetric) << "\n";
         } else {
-            std::cout << std::left << std::setw(25) << result.modelName 
+            std::cout << std::left << std::setw(25) << result.modelName() 
                       << std::setw(50) << ("Error: " + result.errorMessage) << "\n";
         }
     }
@@ -133,7 +133,7 @@ void PredictionDisplay::displayRecommendation(const std::vector<PredictionResult
     std::cout << std::string(Constants::SECTION_SEPARATOR_WIDTH_60, '-') << "\n";
     
     if (bestResult != results.end() && bestResult->isValid && bestResult->confidenceMetric > 0.0) {
-        std::cout << "   RECOMMENDED: " << bestResult->modelName << "\n";
+        std::cout << "   RECOMMENDED: " << bestResult->modelName() << "\n";
         std::cout << "   Confidence: " << formatConfidence(bestResult->confidenceMetric) << "\n";
         std::cout << "   Reason: Highest confidence metric among available models\n";
     } else {
@@ -5,7 +5,7 @@
 #include <string>
 #include <string_view>
 #include "Prediction.h"
-#include "Candlestick.h"
+#include "CandlestickSeries.h"
 #include "Common.h"
 
 //self written code start
@@ -16,7 +16,7 @@ class PredictionDisplay {
 public:
     // Main display method
     static void displayEnhancedResults(
-        const std::vector<Candlestick>& data,
+        const CandlestickSeries& data,
         TimeFrame timeframe,
         std::string_view country,
         int startYear, int endYear,
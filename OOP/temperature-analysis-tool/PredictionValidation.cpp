@@ -9,7 +9,7 @@
 
 //self written code start
 ValidationResult PredictionValidation::validateModel(
-    const std::vector<Candlestick>& data,
+    const CandlestickSeries& data,
     const PredictionFunction& modelFunction,
     int minTrainingSize) {
     
@@ -30,11 +30,9 @@ ValidationResult PredictionValidation::validateModel(
     
     // Perform leave-one-out cross-validation
     for (size_t testIndex = static_cast<size_t>(minTrainingSize); testIndex < data.size(); ++testIndex) {
-        // Create training data efficiently
-        const std::vector<Candlestick> trainingData(data.begin(), data.begin() + static_cast<long>(testIndex));
-        
         try {
-            const PredictionResult predResult = modelFunction(trainingData);
+            // Training data is a view of the rows before the test point; nothing is copied
+            const PredictionResult predResult = modelFunction(CandlestickSeries(data, 0, testIndex));
             
             if (predResult.isValid) {
                 const double actualValue = data[testIndex].getClose();
@@ -68,17 +66,17 @@ ValidationResult PredictionValidation::validateModel(
     return result;
 }
 
-std::vector<ValidationResult> PredictionValidation::validateAllModels(const std::vector<Candlestick>& data) {
+std::vector<ValidationResult> PredictionValidation::validateAllModels(const CandlestickSeries& data) {
     std::vector<ValidationResult> results;
     results.reserve(3);
     
     // Define prediction functions using lambdas
     const std::vector<std::pair<PredictionFunction, int>> models = {
-        {[](const std::vector<Candlestick>& d) { return Prediction::predictLinearWithConfidence(d); }, 
+        {[](const CandlestickSeries& d) { return Prediction::predictLinearWithConfidence(d); }, 
          static_cast<int>(Constants::MIN_LINEAR_DATA_SIZE)},
-        {[](const std::vector<Candlestick>& d) { return Prediction::predictMovingAverageWithConfidence(d, 3); }, 
+        {[](const CandlestickSeries& d) { return Prediction::predictMovingAverageWithConfidence(d, 3); }, 
          static_cast<int>(Constants::MIN_MOVING_AVERAGE_DATA_SIZE)},
-        {[](const std::vector<Candlestick>& d) { return Prediction::predictHeuristicWithConfidence(d); }, 
+        {[](const CandlestickSeries& d) { return Prediction::predictHeuristicWithConfidence(d); }, 
          static_cast<int>(Constants::MIN_HEURISTIC_DATA_SIZE)}
     };
     
@@ -89,7 +87,7 @@ std::vector<ValidationResult> PredictionValidation::validateAllModels(const std:
     return results;
 }
 
-void PredictionValidation::displayValidationResults(const std::vector<Candlestick>& data) {
+void PredictionValidation::displayValidationResults(const CandlestickSeries& data) {
     const auto results = validateAllModels(data);
     
     if (results.empty()) {
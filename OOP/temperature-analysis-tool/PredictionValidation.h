@@ -5,7 +5,7 @@
 #include <string>
 #include <functional>
 #include "Prediction.h"
-#include "Candlestick.h"
+#include "CandlestickSeries.h"
 
 //self written code start
 /**
@@ -35,7 +35,7 @@ struct ValidationResult {
 /**
  * Function pointer type for prediction models
  */
-using PredictionFunction = std::function<PredictionResult(const std::vector<Candlestick>&)>;
+using PredictionFunction = std::function<PredictionResult(const CandlestickSeries&)>;
 
 /**
  * Handles cross-validation of prediction models
@@ -44,15 +44,15 @@ class PredictionValidation {
 public:
     // Validation methods
     static ValidationResult validateModel(
-        const std::vector<Candlestick>& data,
+        const CandlestickSeries& data,
         const PredictionFunction& modelFunction,
         int minTrainingSize = 2
     );
 
-    static std::vector<ValidationResult> validateAllModels(const std::vector<Candlestick>& data);
+    static std::vector<ValidationResult> validateAllModels(const CandlestickSeries& data);
 
     // Display methods
-    static void displayValidationResults(const std::vector<Candlestick>& data);
+    static void displayValidationResults(const CandlestickSeries& data);
 
 private:
     // Helper methods
@@ -0,0 +1,45 @@
+#ifndef QUANTIZED_TEMPERATURE_H
+#define QUANTIZED_TEMPERATURE_H
+
+#include <cstdint>
+#include <cmath>
+#include <limits>
+
+//self written code start
+/**
+ *  Temperatures stored as int16 centi-degrees (hundredths of a degree).
+ *
+ * The dataset has at most two meaningful decimals and the loaders reject
+ * anything beyond +/-100 degrees, so +/-10000 centi-degrees covers every
+ * accepted value with room to spare. A two-decimal reading decodes to exactly
+ * the double the text parser produces; anything finer is rounded to the
+ * nearest 0.01, an error of at most 0.005 degrees.
+ */
+namespace QuantizedTemperature {
+    // Marks a slot with no reading (missing cell or a row skipped for this country)
+    constexpr int16_t MISSING = std::numeric_limits<int16_t>::min();
+    constexpr double CENTI_PER_DEGREE = 100.0;
+
+    constexpr bool isMissing(int16_t value) {
+        return value == MISSING;
+    }
+
+    /**
+     * @return The nearest centi-degree value, or MISSING if the temperature is
+     *         not finite or does not fit.
+     */
+    inline int16_t encode(double celsius) {
+        const double scaled = std::round(celsius * CENTI_PER_DEGREE);
+        if (!(scaled > std::numeric_limits<int16_t>::min() && scaled <= std::numeric_limits<int16_t>::max())) {
+            return MISSING;
+        }
+        return static_cast<int16_t>(scaled);
+    }
+
+    constexpr double decode(int16_t value) {
+        return value / CENTI_PER_DEGREE;
+    }
+}
+
+#endif
+//self written code end
@@ -0,0 +1,174 @@
+#include "RollupPyramid.h"
+#include "TimeGrid.h"
+#include "ParallelAggregation.h"
+#include <algorithm>
+#include <array>
+
+//self written code start
+RollupPyramid::RollupPyramid(const std::vector<CompactTemperatureRecord>& records, unsigned threadCount) {
+    build(records, threadCount);
+}
+
+RollupPyramid::RollupPyramid(const std::pmr::vector<CompactTemperatureRecord>& records, unsigned threadCount) {
+    build(records, threadCount);
+}
+
+template <typename Records>
+void RollupPyramid::build(const Records& records, unsigned threadCount) {
+    recordCount_ = records.size();
+    if (records.empty()) {
+        return;
+    }
+
+    // Loader output is already in time order; only an unordered input is copied and sorted
+    const auto byTime = [](const CompactTemperatureRecord& a, const CompactTemperatureRecord& b) {
+        return a.epochHours < b.epochHours;
+    };
+    const Records* ordered = &records;
+    Records sortedRecords(records.get_allocator());
+    if (!std::is_sorted(records.begin(), records.end(), byTime)) {
+        sortedRecords = records;
+        std::stable_sort(sortedRecords.begin(), sortedRecords.end(), byTime);
+        ordered = &sortedRecords;
+    }
+
+    // The only pass over the readings: one partial per day, plus each slice's
+    // own 24 hour-of-day buckets. Slices start on day boundaries, so every
+    // day lies in one slice; the hour buckets cut across all days and are
+    // merged once the slices are done.
+    const auto& input = *ordered;
+    const std::vector<size_t> boundaries = ParallelAggregation::splitAtKeyChanges(
+        input.size(), ParallelAggregation::sliceCount(threadCount, input.size()),
+        [&input](size_t index) { return TimeGrid::floorDivide(input[index].epochHours, 24); });
+
+    std::vector<Level> sliceDays(boundaries.size() - 1);
+    std::vector<std::array<Partial, 24>> sliceHours(boundaries.size() - 1);
+    ParallelAggregation::forEachSlice(boundaries, [&](size_t slice, size_t begin, size_t end) {
+        Level& days = sliceDays[slice];
+        std::array<Partial, 24>& hours = sliceHours[slice];
+        for (size_t i = begin; i < end; ++i) {
+            const int32_t day = TimeGrid::floorDivide(input[i].epochHours, 24);
+            const double temperature = input[i].temperature;
+            if (days.periods.empty() || days.periods.back() != day) {
+                days.periods.push_back(day);
+                days.partials.emplace_back();
+            }
+            days.partials.back().add(temperature);
+            hours[input[i].epochHours - day * 24].add(temperature);
+        }
+    });
+
+    if (sliceDays.size() == 1) {
+        days_ = std::move(sliceDays.front());
+    } else {
+        for (const Level& days : sliceDays) {
+            days_.periods.insert(days_.periods.end(), days.periods.begin(), days.periods.end());
+            days_.partials.insert(days_.partials.end(), days.partials.begin(), days.partials.end());
+        }
+    }
+
+    Partial hours[24];
+    for (const auto& slice : sliceHours) {
+        for (int32_t hour = 0; hour < 24; ++hour) {
+            hours[hour].merge(slice[hour]);
+        }
+    }
+    for (int32_t hour = 0; hour < 24; ++hour) {
+        if (hours[hour].count > 0) {
+            hours_.periods.push_back(hour);
+            hours_.partials.push_back(hours[hour]);
+        }
+    }
+
+    // Every coarser level is merged from the partials below, never from the readings
+    weeks_ = rollUp(days_, TimeFrame::Daily, TimeFrame::Weekly);
+    months_ = rollUp(days_, TimeFrame::Daily, TimeFrame::Monthly);
+    quarters_ = rollUp(months_, TimeFrame::Monthly, TimeFrame::Quarterly);
+    seasons_ = rollUp(months_, TimeFrame::Monthly, TimeFrame::Seasonal);
+    years_ = rollUp(months_, TimeFrame::Monthly, TimeFrame::Yearly);
+}
+
+void RollupPyramid::Partial::add(double temperature) {
+    if (count == 0) {
+        high = temperature;
+        low = temperature;
+    }
+    sum.add(temperature);
+    if (temperature > high) high = temperature;
+    if (temperature < low) low = temperature;
+    count++;
+}
+
+void RollupPyramid::Partial::merge(const Partial& other) {
+    if (other.count == 0) return;
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+    sum.merge(other.sum);
+    high = std::max(high, other.high);
+    low = std::min(low, other.low);
+    count += other.count;
+}
+
+RollupPyramid::Level RollupPyramid::rollUp(const Level& finer, TimeFrame finerTimeframe, TimeFrame timeframe) {
+    Level coarser;
+    for (size_t i = 0; i < finer.periods.size(); ++i) {
+        const int32_t period = TimeGrid::periodIndex(TimeGrid::periodStart(finer.periods[i], finerTimeframe), timeframe);
+        if (coarser.periods.empty() || coarser.periods.back() != period) {
+            coarser.periods.push_back(period);
+            coarser.partials.emplace_back();
+        }
+        coarser.partials.back().merge(finer.partials[i]);
+    }
+    return coarser;
+}
+
+const RollupPyramid::Level& RollupPyramid::level(TimeFrame timeframe) const {
+    switch (timeframe) {
+        case TimeFrame::Yearly:    return years_;
+        case TimeFrame::Seasonal:  return seasons_;
+        case TimeFrame::Quarterly: return quarters_;
+        case TimeFrame::Monthly:   return months_;
+        case TimeFrame::Weekly:    return weeks_;
+        case TimeFrame::HourOfDay: return hours_;
+        case TimeFrame::Daily:
+        default:                   return days_;
+    }
+}
+
+std::vector<Candlestick> RollupPyramid::candlesticks(TimeFrame timeframe) const {
+    const Level& source = level(timeframe);
+
+    std::vector<Candlestick> candlesticks;
+    candlesticks.reserve(source.periods.size());
+
+    // Track previous period's average for correct "open" calculation
+    double previousPeriodAverage = 0.0;
+    bool hasPreviousPeriod = false;
+
+    for (size_t i = 0; i < source.periods.size(); ++i) {
+        const Partial& partial = source.partials[i];
+        const double currentPeriodAverage = partial.sum.value() / partial.count;
+
+        // For the first period, use the current period's average as both open and close
+        const double open = hasPreviousPeriod ? previousPeriodAverage : currentPeriodAverage;
+
+        candlesticks.emplace_back(TimeGrid::periodStart(source.periods[i], timeframe),
+                                  open, currentPeriodAverage, partial.high, partial.low);
+
+        previousPeriodAverage = currentPeriodAverage;
+        hasPreviousPeriod = true;
+    }
+
+    return candlesticks;
+}
+
+size_t RollupPyramid::memoryUsage() const {
+    size_t bytes = 0;
+    for (const Level* stored : {&days_, &weeks_, &months_, &quarters_, &seasons_, &years_, &hours_}) {
+        bytes += stored->periods.capacity() * sizeof(int32_t) + stored->partials.capacity() * sizeof(Partial);
+    }
+    return bytes;
+}
+//self written code end
@@ -0,0 +1,97 @@
+#ifndef ROLLUP_PYRAMID_H
+#define ROLLUP_PYRAMID_H
+
+#include <vector>
+#include <memory_resource>
+#include <cstddef>
+#include <cstdint>
+#include "Candlestick.h"
+#include "CompactTemperatureRecord.h"
+#include "Common.h"
+#include "ExactSum.h"
+
+//self written code start
+/**
+ *  Aggregates of one selection for every timeframe, built in one pass.
+ *
+ * The readings are scanned once, into a running sum, count, minimum and
+ * maximum per day and into the 24 hour-of-day buckets, which cut across the
+ * days. Each coarser level is then merged from the level below (days into
+ * weeks and months; months into quarters, seasons and years) without
+ * revisiting the readings, so candles for any timeframe come straight from a
+ * level's partials and changing timeframe needs no reload. Memory is
+ * dominated by the daily level, one partial per day that has readings.
+ *
+ * Sums are kept as ExactSum, so merging partials in any grouping gives the
+ * same totals and the candles are identical for every thread count. Each
+ * average is rounded once from the exact sum; computeCandlesticks rounds its
+ * running sum at every reading instead, so the two can differ in the last
+ * bit of an average.
+ */
+class RollupPyramid {
+public:
+    RollupPyramid() = default;
+
+    /**
+     *  Builds every level. Readings are expected in time order, as the loaders
+     * produce them; an unordered input is sorted first.
+     * @param threadCount Threads scanning the readings in contiguous time
+     *        slices (1 = serial, 0 = one per hardware thread); the levels are
+     *        identical either way.
+     */
+    explicit RollupPyramid(const std::vector<CompactTemperatureRecord>& records, unsigned threadCount = 1);
+    explicit RollupPyramid(const std::pmr::vector<CompactTemperatureRecord>& records, unsigned threadCount = 1);
+
+    /**
+     *  Candles for timeframe, by the same rules as
+     * CandlestickCalculator::computeCandlesticks (open = previous period's average).
+     */
+    std::vector<Candlestick> candlesticks(TimeFrame timeframe) const;
+
+    bool empty() const { return days_.periods.empty(); }
+    size_t recordCount() const { return recordCount_; }
+    size_t dayCount() const { return days_.periods.size(); }
+
+    /**
+     *  Approximate heap bytes held by all levels.
+     */
+    size_t memoryUsage() const;
+
+private:
+    struct Partial {
+        ExactSum sum;
+        double high{0.0};
+        double low{0.0};
+        size_t count{0};
+
+        void add(double temperature);
+        void merge(const Partial& other);
+    };
+
+    /**
+     *  One level of the pyramid: partials in increasing period order, each
+     * with its TimeGrid period index.
+     */
+    struct Level {
+        std::vector<int32_t> periods;
+        std::vector<Partial> partials;
+    };
+
+    template <typename Records>
+    void build(const Records& records, unsigned threadCount);
+
+    static Level rollUp(const Level& finer, TimeFrame finerTimeframe, TimeFrame timeframe);
+    const Level& level(TimeFrame timeframe) const;
+
+    Level days_;
+    Level weeks_;
+    Level months_;
+    Level quarters_;
+    Level seasons_;
+    Level years_;
+    Level hours_;
+    size_t recordCount_{0};
+};
+
+#endif
+//self written code end
@@ -0,0 +1,257 @@
+#include "TemperatureCache.h"
+#include "DateTime.h"
+#include "FileStamp.h"
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+
+//self written code start
+namespace TemperatureCache {
+
+namespace {
+    constexpr char CACHE_MAGIC[8] = {'T', 'A', 'C', 'A', 'C', 'H', 'E', '1'};
+    constexpr uint32_t CACHE_VERSION = 2;
+    constexpr size_t COUNTRY_CODE_BYTES = 4;
+    constexpr size_t SUFFIX_BYTES = 7;
+
+    constexpr uint32_t MISSING_BITS = 0x7FC00000u;
+    constexpr uint32_t INVALID_BITS = 0x7FC00001u;
+
+    struct CacheHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t countryCount;
+        uint64_t rowCount;
+        uint64_t sourceSize;
+        int64_t sourceModifiedTime;
+        uint64_t checksum;
+        char dateTimeSeparator;
+        char timestampSuffix[SUFFIX_BYTES];
+    };
+
+    // Country codes are padded so that the numeric columns stay 8-byte aligned
+    size_t countryBlockBytes(size_t countryCount) {
+        return (countryCount * COUNTRY_CODE_BYTES + 7) / 8 * 8;
+    }
+
+    float fromBits(uint32_t bits) {
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    uint32_t toBits(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    /**
+     *  FNV-1a over 64-bit words, with the final partial word folded in byte by byte.
+     * Updates may split the input anywhere; the result only depends on the byte stream.
+     */
+    class Checksum {
+    public:
+        void update(const char* data, size_t size) {
+            while (size > 0 && pendingSize_ > 0) {
+                pending_[pendingSize_++] = data[0];
+                ++data;
+                --size;
+                if (pendingSize_ == sizeof(pending_)) {
+                    mixWord(pending_);
+                    pendingSize_ = 0;
+                }
+            }
+            for (; size >= 8; data += 8, size -= 8) {
+                mixWord(data);
+            }
+            if (size > 0) {
+                // Fewer than 8 bytes are left, and pending_ is empty
+                std::memcpy(pending_, data, size);
+                pendingSize_ = size;
+            }
+        }
+
+        uint64_t value() const {
+            uint64_t hash = hash_;
+            for (size_t i = 0; i < pendingSize_; ++i) {
+                hash = (hash ^ static_cast<unsigned char>(pending_[i])) * PRIME;
+            }
+            return hash;
+        }
+
+    private:
+        void mixWord(const char* bytes) {
+            uint64_t word;
+            std::memcpy(&word, bytes, sizeof(word));
+            hash_ = (hash_ ^ word) * PRIME;
+        }
+
+        static constexpr uint64_t PRIME = 1099511628211ull;
+        uint64_t hash_{14695981039346656037ull};
+        char pending_[8]{};
+        size_t pendingSize_{0};
+    };
+
+    /**
+     *  Checksum of the header (with its checksum field zeroed) and the country
+     * table. The numeric columns are left out: hashing them would make every
+     * open read the whole file. A torn or truncated cache is still caught by
+     * the exact size check, and a cache only appears once it is complete.
+     */
+    uint64_t headerChecksum(CacheHeader header, const char* countryBlock, size_t countryBytes) {
+        header.checksum = 0;
+        Checksum checksum;
+        checksum.update(reinterpret_cast<const char*>(&header), sizeof(header));
+        checksum.update(countryBlock, countryBytes);
+        return checksum.value();
+    }
+}
+
+float missingValue() { return fromBits(MISSING_BITS); }
+float invalidValue() { return fromBits(INVALID_BITS); }
+bool isMissing(float value) { return toBits(value) == MISSING_BITS; }
+bool isInvalid(float value) { return toBits(value) == INVALID_BITS; }
+
+std::string cachePathFor(const std::string& csvPath) {
+    return csvPath + ".tacache";
+}
+
+bool write(const std::string& csvPath, const CacheColumns& columns) {
+    CacheHeader header{};
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.version = CACHE_VERSION;
+    header.countryCount = static_cast<uint32_t>(columns.countryCodes.size());
+    header.rowCount = columns.epochHours.size();
+    header.dateTimeSeparator = columns.dateTimeSeparator;
+    
+    if (columns.timestampSuffix.size() >= SUFFIX_BYTES ||
+        columns.temperatures.size() != columns.countryCodes.size()) {
+        return false;
+    }
+    std::memcpy(header.timestampSuffix, columns.timestampSuffix.data(), columns.timestampSuffix.size());
+    
+    FileStamp source;
+    if (!FileStamp::read(csvPath, source)) {
+        return false;
+    }
+    header.sourceSize = source.size;
+    header.sourceModifiedTime = source.modifiedTime;
+    
+    std::vector<char> countryBlock(countryBlockBytes(columns.countryCodes.size()), '\0');
+    for (size_t i = 0; i < columns.countryCodes.size(); ++i) {
+        const std::string& code = columns.countryCodes[i];
+        if (code.size() > COUNTRY_CODE_BYTES) return false;
+        std::memcpy(countryBlock.data() + i * COUNTRY_CODE_BYTES, code.data(), code.size());
+    }
+    
+    const size_t hourBytes = columns.epochHours.size() * sizeof(int32_t);
+    const size_t columnBytes = columns.epochHours.size() * sizeof(float);
+    for (const auto& column : columns.temperatures) {
+        if (column.size() != columns.epochHours.size()) return false;
+    }
+    header.checksum = headerChecksum(header, countryBlock.data(), countryBlock.size());
+    
+    const std::string cachePath = cachePathFor(csvPath);
+    const std::string tempPath = cachePath + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) return false;
+        
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(countryBlock.data(), static_cast<std::streamsize>(countryBlock.size()));
+        out.write(reinterpret_cast<const char*>(columns.epochHours.data()), static_cast<std::streamsize>(hourBytes));
+        for (const auto& column : columns.temperatures) {
+            out.write(reinterpret_cast<const char*>(column.data()), static_cast<std::streamsize>(columnBytes));
+        }
+        if (!out) {
+            out.close();
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+    
+    return std::rename(tempPath.c_str(), cachePath.c_str()) == 0;
+}
+
+Reader::Reader(const std::string& csvPath)
+    : file_(cachePathFor(csvPath)), isValid_(false), rowCount_(0),
+      hours_(nullptr), temperatures_(nullptr), dateTimeSeparator_(' ') {
+    if (!file_.isOpen() || file_.size() < sizeof(CacheHeader)) {
+        return;
+    }
+    
+    const std::string_view contents = file_.view();
+    CacheHeader header;
+    std::memcpy(&header, contents.data(), sizeof(header));
+    
+    if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) != 0 || header.version != CACHE_VERSION) {
+        return;
+    }
+    
+    // Stale cache: the CSV was modified or replaced after the cache was built
+    FileStamp source;
+    if (!FileStamp::read(csvPath, source) ||
+        source.size != header.sourceSize || source.modifiedTime != header.sourceModifiedTime) {
+        return;
+    }
+    
+    const size_t countryBytes = countryBlockBytes(header.countryCount);
+    const size_t expectedSize = sizeof(CacheHeader) + countryBytes +
+                                header.rowCount * sizeof(int32_t) +
+                                header.rowCount * header.countryCount * sizeof(float);
+    if (contents.size() != expectedSize) {
+        return;
+    }
+    
+    const char* payload = contents.data() + sizeof(CacheHeader);
+    if (headerChecksum(header, payload, countryBytes) != header.checksum) {
+        return;
+    }
+    
+    for (uint32_t i = 0; i < header.countryCount; ++i) {
+        const char* code = payload + i * COUNTRY_CODE_BYTES;
+        countryCodes_.emplace_back(code, strnlen(code, COUNTRY_CODE_BYTES));
+    }
+    
+    rowCount_ = header.rowCount;
+    hours_ = payload + countryBytes;
+    temperatures_ = hours_ + rowCount_ * sizeof(int32_t);
+    dateTimeSeparator_ = header.dateTimeSeparator;
+    timestampSuffix_.assign(header.timestampSuffix, strnlen(header.timestampSuffix, SUFFIX_BYTES));
+    isValid_ = true;
+}
+
+int Reader::findCountry(std::string_view countryCode) const {
+    for (size_t i = 0; i < countryCodes_.size(); ++i) {
+        if (countryCodes_[i] == countryCode) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+int32_t Reader::epochHoursAt(size_t row) const {
+    int32_t hours;
+    std::memcpy(&hours, hours_ + row * sizeof(int32_t), sizeof(hours));
+    return hours;
+}
+
+float Reader::temperatureAt(int country, size_t row) const {
+    float value;
+    std::memcpy(&value, temperatures_ + (static_cast<size_t>(country) * rowCount_ + row) * sizeof(float), sizeof(value));
+    return value;
+}
+
+std::string Reader::timestampAt(size_t row) const {
+    const DateTime dateTime = DateTime::fromEpochHours(epochHoursAt(row));
+    char buffer[19];
+    
+    if (dateTimeSeparator_ == '\0') {
+        dateTime.formatDate(buffer);
+        return std::string(buffer, 10) + timestampSuffix_;
+    }
+    dateTime.formatDateTime(buffer, dateTimeSeparator_);
+    return std::string(buffer, 19) + timestampSuffix_;
+}
+
+} // namespace TemperatureCache
+//self written code end
\ No newline at end of file
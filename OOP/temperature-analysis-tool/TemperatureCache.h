@@ -0,0 +1,86 @@
+#ifndef TEMPERATURE_CACHE_H
+#define TEMPERATURE_CACHE_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include "MappedFile.h"
+
+//self written code start
+/**
+ *  Binary columnar sidecar cache for the weather CSV.
+ *
+ * The cache lives next to the CSV (<csv>.tacache) and holds one packed
+ * timestamp column (hours since 1970) and one float column per country.
+ * Its header records the size and modification time of the CSV it was built
+ * from plus a checksum of the header and country table. Opening a cache
+ * checks the source's size and time first, then the cache's exact size, then
+ * the checksum, so it never reads the numeric columns; a cache that fails any
+ * check is ignored.
+ */
+namespace TemperatureCache {
+    /**
+     *  Fully parsed CSV contents in the shape written to the cache.
+     */
+    struct CacheColumns {
+        std::vector<std::string> countryCodes;
+        std::vector<int32_t> epochHours;                // One entry per data row
+        std::vector<std::vector<float>> temperatures;   // One column per country, aligned with epochHours
+        char dateTimeSeparator{' '};                    // '\0' when the timestamps carry no time of day
+        std::string timestampSuffix;                    // Text after the time field, e.g. "Z"
+    };
+
+    // Cell markers: both are NaN, with different payloads
+    float missingValue();   // Empty / NA / null cell
+    float invalidValue();   // Cell that could not be parsed as a number
+    bool isMissing(float value);
+    bool isInvalid(float value);
+
+    std::string cachePathFor(const std::string& csvPath);
+
+    /**
+     *  Writes the cache for csvPath. The file is written under a temporary
+     * name and renamed into place, so readers never see a partial cache.
+     * @return false if the cache could not be written.
+     */
+    bool write(const std::string& csvPath, const CacheColumns& columns);
+
+    /**
+     *  Memory-maps and validates the cache belonging to a CSV file.
+     */
+    class Reader {
+    public:
+        explicit Reader(const std::string& csvPath);
+
+        bool isValid() const { return isValid_; }
+        size_t rowCount() const { return rowCount_; }
+        size_t countryCount() const { return countryCodes_.size(); }
+
+        /**
+         * @return The country's column index, or -1 if it is not in the cache.
+         */
+        int findCountry(std::string_view countryCode) const;
+
+        int32_t epochHoursAt(size_t row) const;
+        float temperatureAt(int country, size_t row) const;
+
+        /**
+         *  Rebuilds the timestamp text exactly as it appeared in the CSV.
+         */
+        std::string timestampAt(size_t row) const;
+
+    private:
+        MappedFile file_;
+        bool isValid_;
+        size_t rowCount_;
+        std::vector<std::string> countryCodes_;
+        const char* hours_;
+        const char* temperatures_;
+        char dateTimeSeparator_;
+        std::string timestampSuffix_;
+    };
+}
+
+#endif
+//self written code end
\ No newline at end of file
@@ -0,0 +1,154 @@
+#ifndef TIME_GRID_H
+#define TIME_GRID_H
+
+#include <cstdint>
+#include <cstddef>
+#include "Common.h"
+#include "DateTime.h"
+
+//self written code start
+/**
+ *  Regular time grid of aggregation periods.
+ *
+ * Every period of a timeframe gets a consecutive integer index (epoch day,
+ * ISO week, year * 12 + month - 1, quarter, season or the year), so the
+ * distance between two indices is the number of periods between them, gaps
+ * included. A series that records its first period needs no per-row dates: a
+ * row's period follows from its slot on the grid.
+ *
+ * Hour-of-day is the one cyclic timeframe: its index is the hour (0-23) and
+ * every day of the range falls into the same 24 buckets.
+ */
+namespace TimeGrid {
+    constexpr int32_t floorDivide(int32_t value, int32_t divisor) {
+        return (value >= 0 ? value : value - divisor + 1) / divisor;
+    }
+
+    // 1970-01-01 was a Thursday, so ISO week 0 starts on Monday 1969-12-29
+    constexpr int32_t EPOCH_WEEK_OFFSET = 3;
+
+    /**
+     *  Whether the timeframe folds every day onto the same buckets (hour-of-day)
+     * instead of following the calendar.
+     */
+    constexpr bool isCyclic(TimeFrame timeframe) {
+        return timeframe == TimeFrame::HourOfDay;
+    }
+
+    /**
+     *  Index of the period that contains date.
+     */
+    constexpr int32_t periodIndex(const DateTime& date, TimeFrame timeframe) {
+        switch (timeframe) {
+            case TimeFrame::Yearly:    return date.year;
+            case TimeFrame::Quarterly: return date.year * 4 + (date.month - 1) / 3;
+            // Months counted from December of the previous year, three to a season
+            case TimeFrame::Seasonal:  return floorDivide(date.year * 12 + date.month, 3);
+            case TimeFrame::Monthly:   return date.year * 12 + (date.month - 1);
+            case TimeFrame::Weekly:    return floorDivide(date.toEpochDays() + EPOCH_WEEK_OFFSET, 7);
+            case TimeFrame::HourOfDay: return date.hour;
+            case TimeFrame::Daily:
+            default:                   return date.toEpochDays();
+        }
+    }
+
+    /**
+     *  First instant of the period with the given index.
+     */
+    constexpr DateTime periodStart(int32_t index, TimeFrame timeframe) {
+        DateTime start;
+        switch (timeframe) {
+            case TimeFrame::Yearly:
+                start.year = static_cast<int16_t>(index);
+                return start;
+            case TimeFrame::Quarterly: {
+                const int32_t year = floorDivide(index, 4);
+                start.year = static_cast<int16_t>(year);
+                start.month = static_cast<uint8_t>((index - year * 4) * 3 + 1);
+                return start;
+            }
+            case TimeFrame::Seasonal: {
+                // Winter (season 0) of a year starts in December of the year before
+                const int32_t year = floorDivide(index, 4);
+                const int32_t season = index - year * 4;
+                start.year = static_cast<int16_t>(season == 0 ? year - 1 : year);
+                start.month = static_cast<uint8_t>(season == 0 ? 12 : season * 3);
+                return start;
+            }
+            case TimeFrame::Monthly: {
+                const int32_t year = floorDivide(index, 12);
+                start.year = static_cast<int16_t>(year);
+                start.month = static_cast<uint8_t>(index - year * 12 + 1);
+                return start;
+            }
+            case TimeFrame::Weekly:
+                return DateTime::fromEpochDays(index * 7 - EPOCH_WEEK_OFFSET);
+            case TimeFrame::HourOfDay:
+                // The hour on the epoch day; the date carries no meaning
+                start.hour = static_cast<uint8_t>(index);
+                return start;
+            case TimeFrame::Daily:
+            default:
+                return DateTime::fromEpochDays(index);
+        }
+    }
+
+    /**
+     *  First instant of the period that contains date.
+     */
+    constexpr DateTime truncate(const DateTime& date, TimeFrame timeframe) {
+        return periodStart(periodIndex(date, timeframe), timeframe);
+    }
+
+    /**
+     *  Year a period is counted in: the ISO week-numbering year for weeks and
+     * the year of January and February for a DJF winter.
+     */
+    constexpr int periodYear(int32_t index, TimeFrame timeframe) {
+        switch (timeframe) {
+            case TimeFrame::Quarterly:
+            case TimeFrame::Seasonal:  return floorDivide(index, 4);
+            case TimeFrame::Weekly:    return periodStart(index, timeframe).isoWeekYear();
+            default:                   return periodStart(index, timeframe).year;
+        }
+    }
+
+    /**
+     *  Writes the start of a period as table and export text into buffer (at
+     * least 10 characters): "YYYY-MM-DD", or "HH:00" for hour-of-day, whose
+     * date carries no meaning.
+     * @return The number of characters written.
+     */
+    constexpr size_t formatPeriodStart(const DateTime& start, TimeFrame timeframe, char* buffer) {
+        if (isCyclic(timeframe)) {
+            DateTime::writeDigits(buffer, start.hour, 2);
+            buffer[2] = ':';
+            buffer[3] = '0';
+            buffer[4] = '0';
+            return 5;
+        }
+        start.formatDate(buffer);
+        return 10;
+    }
+
+    /**
+     *  "DJF", "MAM", "JJA" or "SON" for a season index.
+     */
+    constexpr const char* seasonAbbreviation(int32_t index) {
+        constexpr const char* SEASONS[] = {"DJF", "MAM", "JJA", "SON"};
+        return SEASONS[index - floorDivide(index, 4) * 4];
+    }
+}
+
+static_assert(TimeGrid::periodIndex(DateTime::fromEpochDays(19692), TimeFrame::Seasonal) ==
+              TimeGrid::periodIndex(DateTime::fromEpochDays(19723), TimeFrame::Seasonal),
+              "December 2023 and January 2024 belong to the same DJF winter");
+static_assert(TimeGrid::periodYear(TimeGrid::periodIndex(DateTime::fromEpochDays(19692), TimeFrame::Seasonal),
+                                   TimeFrame::Seasonal) == 2024,
+              "A DJF winter is counted in the year of its January");
+static_assert(TimeGrid::periodStart(TimeGrid::periodIndex(DateTime::fromEpochDays(18628), TimeFrame::Weekly),
+                                    TimeFrame::Weekly).toEpochDays() == 18624,
+              "Friday 2021-01-01 lies in the ISO week starting Monday 2020-12-28");
+
+#endif
+//self written code end
@@ -1,6 +1,8 @@
 #include "UserInput.h"
 #include "Common.h"
-#include "Candlestick.h"
+#include "CandlestickSeries.h"
+#include "TimeGrid.h"
+#include "DatasetCatalog.h"
 #include <iostream>
 #include <algorithm>
 #include <limits>
@@ -22,8 +24,9 @@
 #endif
 
 namespace {
-    // Use a map as a single source of truth for country codes and their full names.
-    const std::map<std::string, std::string> AVAILABLE_COUNTRIES = {
+    // Full names of the dataset's country codes; also the country list when the
+    // data file's catalog is not available.
+    const std::map<std::string, std::string> COUNTRY_NAMES = {
         {"AT", "Austria"}, {"BE", "Belgium"}, {"BG", "Bulgaria"},
         {"CH", "Switzerland"}, {"CZ", "Czech Rep."}, {"DE", "Germany"},
         {"DK", "Denmark"}, {"EE", "Estonia"}, {"ES", "Spain"},
@@ -56,7 +59,7 @@ namespace {
 
 namespace UserInput {
 
-    void exportToFile(const std::string& filename, const std::vector<Candlestick>& data) {
+    void exportToFile(const std::string& filename, const CandlestickSeries& data) {
         std::ofstream file(filename);
         if (!file.is_open()) {
             std::cerr << "Error: Could not open file " << filename << " for writing\n";
@@ -67,8 +70,10 @@ namespace UserInput {
         file << "Date,Open,High,Low,Close\n";
         
         // Write data
+        char date[10];
         for (const auto& c : data) {
-            file << c.getDate() << ","
+            file.write(date, TimeGrid::formatPeriodStart(c.getDateTime(), data.timeframe(), date));
+            file << ","
                  << std::fixed << std::setprecision(1)
                  << c.getOpen() << ","
                  << c.getHigh() << ","
@@ -80,7 +85,7 @@ namespace UserInput {
         std::cout << "Data exported to " << filename << " (" << data.size() << " records)\n";
     }
     
-    bool askForDataExport(const std::vector<Candlestick>& data, const std::string& defaultPrefix) {
+    bool askForDataExport(const CandlestickSeries& data, const std::string& defaultPrefix) {
         if (data.empty()) {
             std::cout << "No data available for export.\n";
             return false;
@@ -125,15 +130,15 @@ namespace UserInput {
 
 // Forward declaration from Internal namespace
 namespace Internal {
-    bool isValidCountryCode(const std::string& country);
+    bool isValidCountryCode(const std::string& country, const DatasetCatalog* catalog);
 }
 
-std::string getCountryCode() {
+std::string getCountryCode(const DatasetCatalog* catalog) {
     std::string country;
     bool validInput = false;
     
     std::cout << "\n=== Country Selection ===\n";
-    displayAvailableCountries();
+    displayAvailableCountries(catalog);
     
     while (!validInput) {
         std::cout << "\nEnter country code (2 letters): ";
@@ -147,15 +152,15 @@ std::string getCountryCode() {
             continue;
         }
         
-        if (!Internal::isValidCountryCode(country)) {
+        if (!Internal::isValidCountryCode(country, catalog)) {
             std::cout << "Error: '" << country << "' is not a valid country code.\n";
             std::cout << "Please choose from the available countries listed above.\n";
             Internal::clearInputBuffer();
             continue;
         }
         
-        auto it = AVAILABLE_COUNTRIES.find(country);
-        if (it != AVAILABLE_COUNTRIES.end()) {
+        auto it = COUNTRY_NAMES.find(country);
+        if (it != COUNTRY_NAMES.end()) {
             std::cout << "\n✓ Selected: " << country << " (" << it->second << ")\n";
         } else {
             std::cout << "\n✓ Selected: " << country << "\n";
@@ -194,7 +199,7 @@ TimeFrame getTimeFrame() {
     Internal::displayAvailableTimeFrames();
     
     while (true) {
-        std::cout << "\nEnter your choice (1-3): ";
+        std::cout << "\nEnter your choice (1-7): ";
         
         if (!(std::cin >> choice)) {
             std::cout << "Error: Please enter a valid number.\n";
@@ -212,8 +217,22 @@ TimeFrame getTimeFrame() {
             case 3: 
                 std::cout << "\n✓ Selected: Daily aggregation\n";
                 return TimeFrame::Daily;
+            //self written code start
+            case 4: 
+                std::cout << "\n✓ Selected: Weekly (ISO week) aggregation\n";
+                return TimeFrame::Weekly;
+            case 5: 
+                std::cout << "\n✓ Selected: Quarterly aggregation\n";
+                return TimeFrame::Quarterly;
+            case 6: 
+                std::cout << "\n✓ Selected: Seasonal (DJF/MAM/JJA/SON) aggregation\n";
+                return TimeFrame::Seasonal;
+            case 7: 
+                std::cout << "\n✓ Selected: Hour-of-day profile\n";
+                return TimeFrame::HourOfDay;
+            //self written code end
             default:
-                std::cout << "Error: Please enter 1, 2, or 3.\n";
+                std::cout << "Error: Please enter a number from 1 to 7.\n";
                 continue;
         }
     }
@@ -249,7 +268,7 @@ bool askToContinue(const std::string& operation) {
     return getYesNoInput("\nWould you like to " + operation + "? (y/n): ");
 }
 
-bool getFilterCriteria(const std::vector<Candlestick>& candlesticks, TimeFrame timeframe,
+bool getFilterCriteria(const CandlestickSeries& candlesticks, TimeFrame timeframe,
                       FilterType& filterType, std::string& startDate, std::string& endDate,
                       double& minTemp, double& maxTemp, bool& uptrend, double& minVolatility) {
     if (candlesticks.empty()) {
@@ -259,7 +278,13 @@ bool getFilterCriteria(const std::vector<Candlestick>& candlesticks, TimeFrame t
     
     std::cout << "\n=== Filter Selection ===\n";
     std::cout << "Available filter types:\n";
-    std::cout << "  1. Date Range - Filter by specific date range\n";
+    // Hour-of-day candles are hours of an average day, not dates
+    const bool datesApply = !TimeGrid::isCyclic(timeframe);
+    if (datesApply) {
+        std::cout << "  1. Date Range - Filter by specific date range\n";
+    } else {
+        std::cout << "  1. Date Range - Not available for " << Utils::timeFrameToString(timeframe) << " data\n";
+    }
     std::cout << "  2. Temperature Range - Filter by temperature values\n";
     std::cout << "  3. Trend Direction - Filter by upward or downward trends\n";
     std::cout << "  4. Volatility - Filter by temperature volatility\n";
@@ -272,6 +297,11 @@ bool getFilterCriteria(const std::vector<Candlestick>& candlesticks, TimeFrame t
             Internal::clearInputBuffer();
             continue;
         }
+        if (filterChoice == static_cast<int>(FilterType::DateRange) && !datesApply) {
+            std::cout << "Error: " << Utils::timeFrameToString(timeframe)
+                      << " candles are not dated; choose another filter.\n";
+            continue;
+        }
         break;
     }
     
@@ -291,17 +321,28 @@ bool getFilterCriteria(const std::vector<Candlestick>& candlesticks, TimeFrame t
     }
 }
 
-void displayAvailableCountries() {
+void displayAvailableCountries(const DatasetCatalog* catalog) {
     std::cout << "Available countries:\n";
     int i = 0;
-    for (const auto& pair : AVAILABLE_COUNTRIES) {
+    auto printCountry = [&i](const std::string& code, const std::string& name) {
         // Print "  CODE (Full Name)      "
-        std::cout << "  " << std::left << std::setw(4) << pair.first
-                  << std::setw(18) << ("(" + pair.second + ")");
+        std::cout << "  " << std::left << std::setw(4) << code
+                  << std::setw(18) << (name.empty() ? std::string() : "(" + name + ")");
         
         if (++i % 3 == 0) { // Print 3 countries per line
             std::cout << "\n";
         }
+    };
+    
+    if (catalog != nullptr) {
+        for (const auto& code : catalog->countryCodes()) {
+            const auto it = COUNTRY_NAMES.find(code);
+            printCountry(code, it != COUNTRY_NAMES.end() ? it->second : std::string());
+        }
+    } else {
+        for (const auto& pair : COUNTRY_NAMES) {
+            printCountry(pair.first, pair.second);
+        }
     }
     if (i % 3 != 0) {
         std::cout << "\n";
@@ -381,6 +422,14 @@ void displayAvailableTimeFrames() {
     std::cout << "  1. Yearly   - One candlestick per year (recommended for long-term trends)\n";
     std::cout << "  2. Monthly  - One candlestick per month (good for seasonal patterns)\n";
     std::cout << "  3. Daily    - One candlestick per day (detailed short-term analysis)\n";
+    //self written code start
+    std::cout << "  4. Weekly   - One candlestick per ISO week (Monday to Sunday)\n";
+    std::cout << "  5. Quarterly - One candlestick per calendar quarter\n";
+    std::cout << "  6. Seasonal  - One candlestick per meteorological season (DJF/MAM/JJA/SON;\n";
+    std::cout << "                 December counts towards the following year's winter)\n";
+    std::cout << "  7. Hour-of-day - One candlestick per hour of the day over the whole range\n";
+    std::cout << "                (diurnal profile)\n";
+    //self written code end
     std::cout << "\nNote: Daily timeframe will generate many candlesticks and may be\n";
     std::cout << "compressed for display. Consider using shorter date ranges with daily data.\n";
 }
@@ -406,7 +455,7 @@ int getYear(const std::string& prompt, int minYear, int maxYear) {
     }
 }
 
-bool getDateRangeFilter(const std::vector<Candlestick>& candlesticks, TimeFrame timeframe,
+bool getDateRangeFilter(const CandlestickSeries& candlesticks, TimeFrame timeframe,
                        std::string& startDate, std::string& endDate) {
     std::cout << "\n=== Date Range Filter ===\n";
     std::cout << "Available date range: " << candlesticks.front().getDate() 
@@ -433,7 +482,7 @@ bool getDateRangeFilter(const std::vector<Candlestick>& candlesticks, TimeFrame
     return true;
 }
 
-bool getTemperatureRangeFilter(const std::vector<Candlestick>& candlesticks,
+bool getTemperatureRangeFilter(const CandlestickSeries& candlesticks,
                               double& minTemp, double& maxTemp) {
     double dataMinTemp = candlesticks[0].getLow();
     double dataMaxTemp = candlesticks[0].getHigh();
@@ -497,7 +546,7 @@ bool getTrendFilter(bool& uptrend) {
     return true;
 }
 
-bool getVolatilityFilter(const std::vector<Candlestick>& candlesticks, double& minVolatility) {
+bool getVolatilityFilter(const CandlestickSeries& candlesticks, double& minVolatility) {
     std::vector<double> volatilities;
     volatilities.reserve(candlesticks.size());
     for (const auto& candle : candlesticks) {
@@ -529,9 +578,12 @@ std::string toUpperCase(const std::string& str) {
     return result;
 }
 
-bool isValidCountryCode(const std::string& country) {
-    // Check if the country code exists as a key in the map.
-    return AVAILABLE_COUNTRIES.count(country) > 0;
+bool isValidCountryCode(const std::string& country, const DatasetCatalog* catalog) {
+    // The data file decides which countries exist; the built-in list is the fallback
+    if (catalog != nullptr) {
+        return catalog->hasCountry(country);
+    }
+    return COUNTRY_NAMES.count(country) > 0;
 }
 
 void clearInputBuffer() {
@@ -6,11 +6,13 @@
 #include "Common.h"
 
 // self written code start
-class Candlestick;
+class CandlestickSeries;
+class DatasetCatalog;
 
 namespace UserInput {
     // Main input functions
-    std::string getCountryCode();
+    // catalog lists the data file's countries; the built-in list is used if it is null
+    std::string getCountryCode(const DatasetCatalog* catalog = nullptr);
     void getYearRange(int& startYear, int& endYear);
     TimeFrame getTimeFrame();
     bool askForFiltering();
@@ -19,7 +21,7 @@ namespace UserInput {
     
     // Filter-related functions
     bool getFilterCriteria(
-        const std::vector<Candlestick>& candlesticks, 
+        const CandlestickSeries& candlesticks, 
         TimeFrame timeframe,
         FilterType& filterType, 
         std::string& startDate, 
@@ -31,7 +33,7 @@ namespace UserInput {
     );
     
     // Display functions
-    void displayAvailableCountries();
+    void displayAvailableCountries(const DatasetCatalog* catalog = nullptr);
     
     // Screen management functions
     void clearScreen();
@@ -40,31 +42,31 @@ namespace UserInput {
     bool askForPredictionChart();
 
     // Export functions
-    void exportToFile(const std::string& filename, const std::vector<Candlestick>& data);
-    bool askForDataExport(const std::vector<Candlestick>& data, const std::string& defaultPrefix = "temperature_data");     
+    void exportToFile(const std::string& filename, const CandlestickSeries& data);
+    bool askForDataExport(const CandlestickSeries& data, const std::string& defaultPrefix = "temperature_data");     
     
     // Internal functions
     namespace Internal {
         void displayAvailableTimeFrames();
         bool getDateRangeFilter(
-            const std::vector<Candlestick>& candlesticks, 
+            const CandlestickSeries& candlesticks, 
             TimeFrame timeframe,
             std::string& startDate, 
             std::string& endDate
         );
         bool getTemperatureRangeFilter(
-            const std::vector<Candlestick>& candlesticks,
+            const CandlestickSeries& candlesticks,
             double& minTemp, 
             double& maxTemp
         );
         bool getTrendFilter(bool& uptrend);
         bool getVolatilityFilter(
-            const std::vector<Candlestick>& candlesticks, 
+            const CandlestickSeries& candlesticks, 
             double& minVolatility
         );
         
         std::string toUpperCase(const std::string& str);
-        bool isValidCountryCode(const std::string& country);
+        bool isValidCountryCode(const std::string& country, const DatasetCatalog* catalog = nullptr);
         void clearInputBuffer();
         int getYear(const std::string& prompt, int minYear, int maxYear);
     }
@@ -0,0 +1,115 @@
+#include "YearIndex.h"
+#include "FileStamp.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+
+//self written code start
+namespace {
+    constexpr char INDEX_MAGIC[8] = {'T', 'A', 'Y', 'I', 'D', 'X', '0', '1'};
+
+    struct IndexHeader {
+        char magic[8];
+        uint64_t sourceSize;
+        int64_t sourceModifiedTime;
+        uint64_t endOffset;
+        uint64_t entryCount;
+    };
+
+    static_assert(sizeof(YearIndex::Entry) == 16, "YearIndex::Entry is written to disk as-is");
+
+    int monthKey(int year, int month) {
+        return year * 12 + (month - 1);
+    }
+}
+
+YearIndex::YearIndex(std::vector<Entry> entries, uint64_t endOffset)
+    : entries_(std::move(entries)), endOffset_(endOffset) {}
+
+std::string YearIndex::indexPathFor(const std::string& csvPath) {
+    return csvPath + ".tayidx";
+}
+
+bool YearIndex::load(const std::string& csvPath, YearIndex& index) {
+    const MappedFile file(indexPathFor(csvPath));
+    if (!file.isOpen() || file.size() < sizeof(IndexHeader)) {
+        return false;
+    }
+    
+    const std::string_view contents = file.view();
+    IndexHeader header;
+    std::memcpy(&header, contents.data(), sizeof(header));
+    
+    FileStamp source;
+    if (std::memcmp(header.magic, INDEX_MAGIC, sizeof(header.magic)) != 0 ||
+        !FileStamp::read(csvPath, source) ||
+        source.size != header.sourceSize || source.modifiedTime != header.sourceModifiedTime ||
+        contents.size() != sizeof(IndexHeader) + header.entryCount * sizeof(Entry)) {
+        return false;
+    }
+    
+    std::vector<Entry> entries(header.entryCount);
+    std::memcpy(entries.data(), contents.data() + sizeof(IndexHeader), header.entryCount * sizeof(Entry));
+    index = YearIndex(std::move(entries), header.endOffset);
+    return true;
+}
+
+bool YearIndex::save(const std::string& csvPath) const {
+    IndexHeader header{};
+    std::memcpy(header.magic, INDEX_MAGIC, sizeof(header.magic));
+    
+    FileStamp source;
+    if (!FileStamp::read(csvPath, source)) {
+        return false;
+    }
+    header.sourceSize = source.size;
+    header.sourceModifiedTime = source.modifiedTime;
+    header.endOffset = endOffset_;
+    header.entryCount = entries_.size();
+    
+    const std::string indexPath = indexPathFor(csvPath);
+    const std::string tempPath = indexPath + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) return false;
+        
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(entries_.data()), 
+                  static_cast<std::streamsize>(entries_.size() * sizeof(Entry)));
+        if (!out) {
+            out.close();
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+    
+    return std::rename(tempPath.c_str(), indexPath.c_str()) == 0;
+}
+
+bool YearIndex::findRange(int startYear, int startMonth, int endYear, int endMonth,
+                          size_t& begin, size_t& end, int& firstLine) const {
+    const int startKey = monthKey(startYear, startMonth);
+    const int endKey = monthKey(endYear, endMonth);
+    
+    // Entries are in file order and strictly increasing in (year, month)
+    const auto first = std::find_if(entries_.begin(), entries_.end(), [startKey](const Entry& entry) {
+        return monthKey(entry.year, entry.month) >= startKey;
+    });
+    const auto last = std::find_if(first, entries_.end(), [endKey](const Entry& entry) {
+        return monthKey(entry.year, entry.month) > endKey;
+    });
+    
+    end = (last != entries_.end()) ? last->offset : endOffset_;
+    if (first == last) {
+        begin = end;
+        firstLine = 0;
+        return false;
+    }
+    
+    begin = first->offset;
+    firstLine = static_cast<int>(first->lineNumber);
+    return true;
+}
+//self written code end
\ No newline at end of file
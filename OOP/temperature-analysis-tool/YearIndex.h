@@ -0,0 +1,61 @@
+#ifndef YEAR_INDEX_H
+#define YEAR_INDEX_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+//self written code start
+/**
+ *  Sparse (year, month) -> byte offset index for a chronologically ordered CSV.
+ *
+ * Persisted next to the data file (<csv>.tayidx) together with the size and
+ * modification time of the CSV, so a stale index is never used. With the
+ * index the loader only visits the rows of the requested time window.
+ */
+class YearIndex {
+public:
+    /**
+     *  First data row of one calendar month.
+     */
+    struct Entry {
+        int16_t year;
+        uint8_t month;
+        uint8_t reserved;
+        uint32_t lineNumber;
+        uint64_t offset;
+    };
+
+    YearIndex() = default;
+    YearIndex(std::vector<Entry> entries, uint64_t endOffset);
+
+    static std::string indexPathFor(const std::string& csvPath);
+
+    /**
+     *  Loads the index persisted for csvPath.
+     * @return false if there is no index or it was built from another version of the file.
+     */
+    static bool load(const std::string& csvPath, YearIndex& index);
+    bool save(const std::string& csvPath) const;
+
+    /**
+     *  Finds the byte range holding every row from startYear-startMonth through
+     * endYear-endMonth (inclusive).
+     * @param firstLine Receives the file line number of the row at begin.
+     * @return false if no row falls inside the window (begin == end).
+     */
+    bool findRange(int startYear, int startMonth, int endYear, int endMonth,
+                   size_t& begin, size_t& end, int& firstLine) const;
+
+    bool findRange(int startYear, int endYear, size_t& begin, size_t& end, int& firstLine) const {
+        return findRange(startYear, 1, endYear, 12, begin, end, firstLine);
+    }
+
+private:
+    std::vector<Entry> entries_;
+    uint64_t endOffset_{0};
+};
+
+#endif
+//self written code end
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include <iostream>
 #include <string>
+#include <cstdlib>
 #include "ApplicationController.h"
 
 
@@ -15,15 +16,39 @@
  * - Temperature prediction using multiple models with confidence metrics
  * - Cross-validation and prediction comparison charts
  * 
+ * Pass --follow to keep each analysed selection in memory and only parse
+ * rows appended to the data file when the same selection is analysed again.
+ * Pass --memory-budget=<MiB> to stream record batches straight into the
+ * candlestick aggregation for data files larger than memory.
+ * Pass --threads=<n> to parse with n threads and build the daily and hourly
+ * rollups of a full load in n time slices (default: one per hardware thread;
+ * the results are the same for any n). --follow and --memory-budget run
+ * serially and ignore it.
+ * 
  * @return 0 on successful completion, non-zero on error
  */
-int main() {
+int main(int argc, char* argv[]) {
     // Configuration
     const std::string dataFilePath = "./weather_data_EU_1980-2019_temp_only.csv";
+    bool followMode = false;
+    size_t memoryBudgetBytes = 0;
+    unsigned threadCount = 0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        const std::string budgetOption = "--memory-budget=";
+        const std::string threadsOption = "--threads=";
+        if (argument == "--follow") {
+            followMode = true;
+        } else if (argument.compare(0, budgetOption.size(), budgetOption) == 0) {
+            memoryBudgetBytes = std::strtoull(argument.c_str() + budgetOption.size(), nullptr, 10) << 20;
+        } else if (argument.compare(0, threadsOption.size(), threadsOption) == 0) {
+            threadCount = static_cast<unsigned>(std::strtoul(argument.c_str() + threadsOption.size(), nullptr, 10));
+        }
+    }
     
     try {
         // Create and run the application controller
-        ApplicationController app(dataFilePath);
+        ApplicationController app(dataFilePath, followMode, memoryBudgetBytes, threadCount);
         return app.run();
         
     } catch (const std::exception& e) {
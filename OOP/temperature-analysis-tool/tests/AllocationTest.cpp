@@ -0,0 +1,183 @@
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <memory_resource>
+#include "TestSupport.h"
+#include "AnalysisArena.h"
+#include "CandlestickCalculator.h"
+#include "CandlestickAggregator.h"
+#include "CandlestickSeries.h"
+#include "DataFilter.h"
+#include "Prediction.h"
+#include "PredictionValidation.h"
+#include "PredictionChart.h"
+
+//self written code start
+/**
+ *  Heap allocations per stage, counted by replacing the global operator new.
+ *
+ * Each stage is run on inputs of two sizes. Steady-state work must not
+ * allocate per element: the aggregator allocates once per period (a map
+ * node), and filtering, cross-validation and rolling prediction allocate the
+ * same number of times whatever the number of candles. The analysis pipeline
+ * must also make fewer heap allocations with an AnalysisArena than without.
+ */
+namespace {
+    size_t allocationCount = 0;
+
+    void* countedAllocation(size_t bytes) {
+        ++allocationCount;
+        if (void* pointer = std::malloc(bytes != 0 ? bytes : 1)) {
+            return pointer;
+        }
+        throw std::bad_alloc();
+    }
+
+    void* countedAlignedAllocation(size_t bytes, std::align_val_t alignment) {
+        ++allocationCount;
+        // aligned_alloc wants a non-zero multiple of the alignment
+        const size_t align = static_cast<size_t>(alignment);
+        const size_t rounded = (bytes / align + 1) * align;
+        if (void* pointer = std::aligned_alloc(align, rounded)) {
+            return pointer;
+        }
+        throw std::bad_alloc();
+    }
+
+    /**
+     *  Heap allocations made while running stage.
+     */
+    template <typename Stage>
+    size_t allocationsDuring(Stage stage) {
+        const size_t before = allocationCount;
+        stage();
+        return allocationCount - before;
+    }
+
+    size_t aggregatorAllocations(const std::vector<TemperatureRecord>& records, TimeFrame timeframe,
+                                 size_t& periods) {
+        CandlestickAggregator aggregator(timeframe);
+        const size_t allocations = allocationsDuring([&]() { aggregator.add(records); });
+        periods = aggregator.periodCount();
+        return allocations;
+    }
+
+    size_t filterAllocations(const CandlestickSeries& series) {
+        // Silence the filter statistics while counting
+        std::streambuf* console = std::cout.rdbuf(nullptr);
+        const size_t allocations = allocationsDuring([&]() {
+            DataFilter::filterByTemperatureRange(series, 0.0, 15.0);
+            DataFilter::filterByTrend(series, true);
+            DataFilter::filterByVolatility(series, 1.0);
+        });
+        std::cout.rdbuf(console);
+        return allocations;
+    }
+
+    size_t validationAllocations(const CandlestickSeries& series) {
+        const PredictionFunction movingAverage = [](const CandlestickSeries& data) {
+            return Prediction::predictMovingAverageWithConfidence(data, 3);
+        };
+        const PredictionFunction linear = [](const CandlestickSeries& data) {
+            return Prediction::predictLinearWithConfidence(data);
+        };
+        return allocationsDuring([&]() {
+            PredictionValidation::validateModel(series, movingAverage, 3);
+            PredictionValidation::validateModel(series, linear, 3);
+        });
+    }
+
+    /**
+     *  The temporaries of one analysis as performSingleAnalysis makes them
+     * (records, aggregation, the candle series, a copy, two filters and
+     * cross-validation), all allocated from resource.
+     */
+    size_t analysisAllocations(const std::vector<CompactTemperatureRecord>& loaded, TimeFrame timeframe,
+                               std::pmr::memory_resource* resource) {
+        std::streambuf* console = std::cout.rdbuf(nullptr);
+        const size_t allocations = allocationsDuring([&]() {
+            std::pmr::vector<CompactTemperatureRecord> records(loaded.begin(), loaded.end(), resource);
+            const CandlestickSeries candlesticks(CandlestickCalculator::computeCandlesticks(records, timeframe),
+                                                 timeframe, resource);
+            const CandlestickSeries dataForAnalysis = candlesticks;
+            const CandlestickSeries filtered = DataFilter::filterByTrend(
+                DataFilter::filterByTemperatureRange(dataForAnalysis, 2.0, 9.0), true);
+            PredictionValidation::validateAllModels(filtered);
+        });
+        std::cout.rdbuf(console);
+        return allocations;
+    }
+
+    size_t rollingPredictionAllocations(const CandlestickSeries& series) {
+        const std::function<PredictionResult(const CandlestickSeries&)> heuristic = [](const CandlestickSeries& data) {
+            return Prediction::predictHeuristicWithConfidence(data);
+        };
+        return allocationsDuring([&]() { PredictionChart::generateRollingPredictions(series, heuristic, 2); });
+    }
+}
+
+void* operator new(size_t bytes) { return countedAllocation(bytes); }
+void* operator new[](size_t bytes) { return countedAllocation(bytes); }
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { std::free(pointer); }
+// std::pmr::new_delete_resource() allocates through the aligned forms
+void* operator new(size_t bytes, std::align_val_t alignment) { return countedAlignedAllocation(bytes, alignment); }
+void* operator new[](size_t bytes, std::align_val_t alignment) { return countedAlignedAllocation(bytes, alignment); }
+void operator delete(void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept { std::free(pointer); }
+
+int main() {
+    // Aggregation: one map node per period, never one per record
+    for (TimeFrame timeframe : {TimeFrame::Daily, TimeFrame::Monthly, TimeFrame::Yearly}) {
+        const std::vector<TemperatureRecord> records = TestSupport::hourlyRecords(2 * 366);
+        size_t periods = 0;
+        const size_t allocations = aggregatorAllocations(records, timeframe, periods);
+        std::cout << "CandlestickAggregator (" << Utils::timeFrameToString(timeframe) << "): "
+                  << allocations << " allocations for " << records.size() << " records, "
+                  << periods << " periods\n";
+        CHECK(allocations <= periods);
+    }
+
+    // Filtering, validation and rolling prediction: the same count for 1000 and 4000 candles
+    const CandlestickSeries small(TestSupport::dailyCandles(1000), TimeFrame::Daily);
+    const CandlestickSeries large(TestSupport::dailyCandles(4000), TimeFrame::Daily);
+
+    const size_t filterSmall = filterAllocations(small), filterLarge = filterAllocations(large);
+    std::cout << "DataFilter: " << filterSmall << " / " << filterLarge << " allocations for "
+              << small.size() << " / " << large.size() << " candles\n";
+    CHECK(filterSmall == filterLarge);
+
+    const size_t validationSmall = validationAllocations(small), validationLarge = validationAllocations(large);
+    std::cout << "PredictionValidation::validateModel: " << validationSmall << " / " << validationLarge
+              << " allocations\n";
+    CHECK(validationSmall == validationLarge);
+
+    const size_t rollingSmall = rollingPredictionAllocations(small), rollingLarge = rollingPredictionAllocations(large);
+    std::cout << "PredictionChart::generateRollingPredictions: " << rollingSmall << " / " << rollingLarge
+              << " allocations\n";
+    CHECK(rollingSmall == rollingLarge);
+
+    // Arena: the same analysis with fewer heap allocations than on the default resource
+    const std::vector<CompactTemperatureRecord> loaded = TestSupport::compactRecords(TestSupport::hourlyRecords(4 * 365));
+    for (TimeFrame timeframe : {TimeFrame::Daily, TimeFrame::Monthly}) {
+        const size_t heap = analysisAllocations(loaded, timeframe, std::pmr::get_default_resource());
+        size_t arenaAllocations = 0;
+        size_t arenaBlocks = 0;
+        {
+            AnalysisArena arena;
+            arenaAllocations = analysisAllocations(loaded, timeframe, arena.resource());
+            arenaBlocks = arena.blockCount();
+        }
+        std::cout << "AnalysisArena (" << Utils::timeFrameToString(timeframe) << "): " << heap
+                  << " heap allocations without the arena, " << arenaAllocations << " with it ("
+                  << arenaBlocks << " arena blocks)\n";
+        CHECK(arenaAllocations < heap);
+    }
+
+    return TestSupport::finish("AllocationTest");
+}
+//self written code end
@@ -0,0 +1,68 @@
+#include <vector>
+#include "TestSupport.h"
+#include "CandlestickCalculator.h"
+#include "ParallelAggregation.h"
+#include "RollupPyramid.h"
+
+//self written code start
+/**
+ *  Thread-count invariance of the parallel aggregation: computeCandlesticks
+ * and RollupPyramid must give exactly the same candles, compared with ==,
+ * for every timeframe whatever the number of threads.
+ *
+ * The slice threshold is lowered so that a few years of hourly readings are
+ * really split into several slices, with boundaries inside weeks, months and
+ * seasons.
+ */
+namespace {
+    const unsigned THREAD_COUNTS[] = {2, 3, 4, 7, 0};
+
+    const TimeFrame TIMEFRAMES[] = {TimeFrame::Daily, TimeFrame::Weekly, TimeFrame::Monthly, TimeFrame::Quarterly,
+                                    TimeFrame::Seasonal, TimeFrame::Yearly, TimeFrame::HourOfDay};
+
+    size_t mismatches(const std::vector<Candlestick>& expected, const std::vector<Candlestick>& actual) {
+        if (expected.size() != actual.size()) {
+            return expected.size() + actual.size();
+        }
+        size_t count = 0;
+        for (size_t i = 0; i < expected.size(); ++i) {
+            const Candlestick& a = expected[i];
+            const Candlestick& b = actual[i];
+            count += a.getDateKey() != b.getDateKey() || a.getOpen() != b.getOpen() ||
+                     a.getClose() != b.getClose() || a.getHigh() != b.getHigh() || a.getLow() != b.getLow();
+        }
+        return count;
+    }
+}
+
+int main() {
+    ParallelAggregation::minItemsPerSlice() = 256;
+    const std::vector<CompactTemperatureRecord> records =
+        TestSupport::compactRecords(TestSupport::hourlyRecords(3 * 366));
+    CHECK(ParallelAggregation::sliceCount(7, records.size()) == 7);
+
+    const RollupPyramid serialPyramid(records, 1);
+    for (TimeFrame timeframe : TIMEFRAMES) {
+        const std::vector<Candlestick> serial = CandlestickCalculator::computeCandlesticks(records, timeframe, 1);
+        const std::vector<Candlestick> serialRollup = serialPyramid.candlesticks(timeframe);
+        CHECK(!serial.empty());
+        CHECK(serialRollup.size() == serial.size());
+
+        size_t calculatorMismatches = 0;
+        size_t pyramidMismatches = 0;
+        for (unsigned threads : THREAD_COUNTS) {
+            calculatorMismatches +=
+                mismatches(serial, CandlestickCalculator::computeCandlesticks(records, timeframe, threads));
+            pyramidMismatches += mismatches(serialRollup, RollupPyramid(records, threads).candlesticks(timeframe));
+        }
+        std::cout << Utils::timeFrameToString(timeframe) << ": " << serial.size() << " candles, "
+                  << calculatorMismatches << " computeCandlesticks and " << pyramidMismatches
+                  << " RollupPyramid candles differ from one thread\n";
+        CHECK(calculatorMismatches == 0);
+        CHECK(pyramidMismatches == 0);
+    }
+
+    ParallelAggregation::minItemsPerSlice() = ParallelAggregation::MIN_ITEMS_PER_SLICE;
+    return TestSupport::finish("ParallelAggregationTest");
+}
+//self written code end
@@ -0,0 +1,115 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <utility>
+#include "TestSupport.h"
+#include "DataLoader.h"
+#include "CandlestickCalculator.h"
+
+//self written code start
+/**
+ *  Bounds the error of the int16 centi-degree storage mode against the
+ * double path: the same multi-country file is loaded with and without
+ * LoaderConfig::quantizeTemperatures and every reading and every candle must
+ * agree to within half a centi-degree.
+ */
+namespace {
+    // 0.005 itself, plus slack for three-decimal values that are not exact in binary
+    constexpr double TOLERANCE = 0.005 + 1e-9;
+
+    const char* const TEST_FILE = "quantization_test.csv";
+
+    /**
+     *  Two countries of hourly three-decimal readings, with the occasional
+     * missing cell, written in the dataset's wide layout.
+     */
+    void writeTestFile(int days) {
+        std::ofstream file(TEST_FILE);
+        file << "utc_timestamp,AT_temperature,DE_temperature\n";
+        const std::vector<TemperatureRecord> records = TestSupport::hourlyRecords(days);
+        char value[16];
+        for (size_t row = 0; row < records.size(); ++row) {
+            std::string line = records[row].date;
+            line[10] = 'T';
+            file << line << 'Z';
+            std::snprintf(value, sizeof(value), "%.3f", records[row].temperature);
+            file << ',' << value;
+            std::snprintf(value, sizeof(value), "%.3f", -0.5 * records[row].temperature + 0.007 * (row % 11));
+            file << ',' << (row % 97 == 5 ? "" : value) << '\n';
+        }
+    }
+
+    std::vector<std::pair<std::string, double>> readings(const MultiCountryData& data, const CountrySeries& series) {
+        std::vector<std::pair<std::string, double>> result;
+        series.forEachReading([&](size_t dateIndex, double temperature) {
+            result.emplace_back(data.dates[dateIndex], temperature);
+        });
+        return result;
+    }
+
+    bool near(double exact, double quantized) {
+        return std::fabs(exact - quantized) <= TOLERANCE;
+    }
+}
+
+int main() {
+    writeTestFile(2 * 366);
+
+    DataLoader::LoaderConfig config;
+    config.useCache = false;
+    const std::vector<std::string> countries = {"AT", "DE"};
+    const MultiCountryData exact = DataLoader::loadCSVMulti(TEST_FILE, countries, 2000, 2001, config);
+    config.quantizeTemperatures = true;
+    const MultiCountryData quantized = DataLoader::loadCSVMulti(TEST_FILE, countries, 2000, 2001, config);
+    std::remove(TEST_FILE);
+
+    CHECK(exact.series.size() == countries.size());
+    CHECK(quantized.series.size() == countries.size());
+    for (const std::string& country : countries) {
+        const CountrySeries* exactSeries = exact.find(country);
+        const CountrySeries* quantizedSeries = quantized.find(country);
+        CHECK(exactSeries != nullptr && quantizedSeries != nullptr);
+        if (exactSeries == nullptr || quantizedSeries == nullptr) continue;
+        CHECK(quantizedSeries->isQuantized());
+
+        // Every reading: same dates, values within half a centi-degree
+        const auto exactReadings = readings(exact, *exactSeries);
+        const auto quantizedReadings = readings(quantized, *quantizedSeries);
+        CHECK(!exactReadings.empty());
+        CHECK(exactReadings.size() == quantizedReadings.size());
+        size_t readingMismatches = 0;
+        double worstReading = 0.0;
+        for (size_t i = 0; i < exactReadings.size() && i < quantizedReadings.size(); ++i) {
+            readingMismatches += exactReadings[i].first != quantizedReadings[i].first ||
+                                 !near(exactReadings[i].second, quantizedReadings[i].second);
+            worstReading = std::max(worstReading, std::fabs(exactReadings[i].second - quantizedReadings[i].second));
+        }
+        std::cout << country << ": " << exactReadings.size() << " readings, largest error " << worstReading << "\n";
+        CHECK(readingMismatches == 0);
+
+        // Every candle: the averages, highs and lows inherit the same bound
+        for (TimeFrame timeframe : {TimeFrame::Daily, TimeFrame::Weekly, TimeFrame::Monthly, TimeFrame::Yearly}) {
+            const std::vector<Candlestick> exactCandles =
+                CandlestickCalculator::computeCandlesticks(exact, *exactSeries, timeframe);
+            const std::vector<Candlestick> quantizedCandles =
+                CandlestickCalculator::computeCandlesticks(quantized, *quantizedSeries, timeframe);
+            CHECK(exactCandles.size() == quantizedCandles.size());
+            size_t candleMismatches = 0;
+            for (size_t i = 0; i < exactCandles.size() && i < quantizedCandles.size(); ++i) {
+                const Candlestick& a = exactCandles[i];
+                const Candlestick& b = quantizedCandles[i];
+                candleMismatches += a.getDateKey() != b.getDateKey() ||
+                                    !near(a.getOpen(), b.getOpen()) || !near(a.getClose(), b.getClose()) ||
+                                    !near(a.getHigh(), b.getHigh()) || !near(a.getLow(), b.getLow());
+            }
+            std::cout << country << " " << Utils::timeFrameToString(timeframe) << ": "
+                      << exactCandles.size() << " candles, " << candleMismatches << " outside the bound\n";
+            CHECK(candleMismatches == 0);
+        }
+    }
+
+    return TestSupport::finish("QuantizationTest");
+}
+//self written code end
@@ -0,0 +1,134 @@
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "CsvScanner.h"
+#include "MappedFile.h"
+
+//self written code start
+/**
+ *  Tokenising throughput of every CsvScanner kernel on a real data file,
+ * against the per-character loop the loaders used before the scanner.
+ *
+ * Usage: ScannerBenchmark [file.csv]   (make bench_scanner DATA_FILE=...)
+ *
+ * Each variant splits every row of the file into cells; the best of several
+ * passes is reported in MB/s of input. The cell counts must agree, or the
+ * benchmark fails.
+ */
+namespace {
+    constexpr int PASSES = 5;
+    constexpr size_t MAX_CELLS = 1024;
+
+    struct Measurement {
+        double seconds;
+        size_t cells;
+    };
+
+    template <typename Pass>
+    Measurement bestOf(Pass pass) {
+        Measurement best{0.0, 0};
+        for (int i = 0; i < PASSES; ++i) {
+            const auto start = std::chrono::steady_clock::now();
+            const size_t cells = pass();
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (i == 0 || elapsed.count() < best.seconds) {
+                best = {elapsed.count(), cells};
+            }
+        }
+        return best;
+    }
+
+    /**
+     *  The loaders' tokeniser before CsvScanner: one std::string per cell,
+     * built a character at a time.
+     */
+    size_t characterLoopPass(std::string_view contents) {
+        size_t cells = 0;
+        std::vector<std::string> columns;
+        size_t position = 0;
+        while (position < contents.size()) {
+            size_t newline = contents.find('\n', position);
+            if (newline == std::string_view::npos) newline = contents.size();
+            std::string_view line = contents.substr(position, newline - position);
+            position = newline + 1;
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+            columns.clear();
+            bool inQuotes = false;
+            std::string currentCell;
+            for (char c : line) {
+                if (c == '"') {
+                    inQuotes = !inQuotes;
+                } else if (c == ',' && !inQuotes) {
+                    columns.push_back(currentCell);
+                    currentCell.clear();
+                } else {
+                    currentCell += c;
+                }
+            }
+            columns.push_back(currentCell); // Add the last cell
+            cells += columns.size();
+        }
+        return cells;
+    }
+
+    size_t scannerPass(std::string_view contents) {
+        size_t cells = 0;
+        uint32_t cellEnds[MAX_CELLS];
+        size_t position = 0;
+        while (position < contents.size()) {
+            size_t cellCount = 0;
+            const size_t rowEnd = CsvScanner::scanRow(contents.data() + position, contents.size() - position,
+                                                      MAX_CELLS, cellEnds, cellCount);
+            cells += cellCount;
+            position += rowEnd + 1;
+        }
+        return cells;
+    }
+
+    void report(const std::string& name, const Measurement& measurement, size_t bytes) {
+        std::cout << "  " << std::left << std::setw(22) << name << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(9) << bytes / measurement.seconds / 1e6 << " MB/s  ("
+                  << std::setprecision(2) << measurement.seconds * 1e3 << " ms, "
+                  << measurement.cells << " cells)\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::string filename = argc > 1 ? argv[1] : "weather_data_EU_1980-2019_temp_only.csv";
+    const MappedFile file(filename);
+    if (!file.isOpen() || file.size() == 0) {
+        std::cerr << "Error: Could not open file '" << filename << "'" << std::endl;
+        return 1;
+    }
+    const std::string_view contents = file.view();
+    std::cout << "Tokenising " << filename << " (" << contents.size() / 1e6 << " MB), best of "
+              << PASSES << " passes:\n";
+
+    const Measurement baseline = bestOf([&]() { return characterLoopPass(contents); });
+    report("for (char c : line)", baseline, contents.size());
+
+    bool consistent = true;
+    const CsvScanner::Kernel original = CsvScanner::activeKernel();
+    for (CsvScanner::Kernel kernel : {CsvScanner::Kernel::Scalar, CsvScanner::Kernel::SSE2, CsvScanner::Kernel::AVX2}) {
+        const std::string name = std::string("scanRow, ") + CsvScanner::kernelName(kernel);
+        if (!CsvScanner::setKernel(kernel)) {
+            std::cout << "  " << std::left << std::setw(22) << name << "not supported on this CPU\n";
+            continue;
+        }
+        const Measurement scanned = bestOf([&]() { return scannerPass(contents); });
+        report(name, scanned, contents.size());
+        consistent = consistent && scanned.cells == baseline.cells;
+    }
+    CsvScanner::setKernel(original);
+
+    if (!consistent) {
+        std::cout << "ScannerBenchmark: cell counts differ between the tokenisers\n";
+        return 1;
+    }
+    return 0;
+}
+//self written code end
@@ -0,0 +1,95 @@
+#ifndef TEST_SUPPORT_H
+#define TEST_SUPPORT_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include "DateTime.h"
+#include "Candlestick.h"
+#include "TemperatureRecord.h"
+#include "CompactTemperatureRecord.h"
+
+//self written code start
+/**
+ *  Minimal checks shared by the test programs in tests/. A failed CHECK
+ * prints its location and makes the program exit non-zero; there is no
+ * framework to install.
+ */
+namespace TestSupport {
+    inline int& failureCount() {
+        static int failures = 0;
+        return failures;
+    }
+
+    inline int finish(const char* testName) {
+        if (failureCount() == 0) {
+            std::cout << testName << ": all checks passed\n";
+            return 0;
+        }
+        std::cout << testName << ": " << failureCount() << " check(s) failed\n";
+        return 1;
+    }
+
+    /**
+     *  Synthetic hourly readings from 2000-01-01 with a daily and a yearly
+     * cycle, in time order. Values have three decimals like the dataset.
+     */
+    inline std::vector<TemperatureRecord> hourlyRecords(int days) {
+        std::vector<TemperatureRecord> records;
+        records.reserve(static_cast<size_t>(days) * 24);
+        const int32_t firstDay = DateTime{2000, 1, 1}.toEpochDays();
+        char text[19];
+        for (int32_t hour = 0; hour < days * 24; ++hour) {
+            DateTime::fromEpochHours(firstDay * 24 + hour).formatDateTime(text);
+            const double temperature = std::round((10.0 + 12.0 * std::sin(hour / 1400.0) +
+                                                   4.0 * std::sin(hour / 3.8)) * 1000.0) / 1000.0;
+            records.emplace_back(std::string(text, sizeof(text)), temperature);
+        }
+        return records;
+    }
+
+    /**
+     *  The same readings as 8-byte records, as DataLoader::loadCompact stores them.
+     */
+    inline std::vector<CompactTemperatureRecord> compactRecords(const std::vector<TemperatureRecord>& records) {
+        std::vector<CompactTemperatureRecord> compact;
+        compact.reserve(records.size());
+        for (const TemperatureRecord& record : records) {
+            DateTime dateTime;
+            char separator;
+            size_t consumed;
+            if (DateTime::parse(record.date, dateTime, separator, consumed)) {
+                compact.push_back({dateTime.toEpochHours(), static_cast<float>(record.temperature)});
+            }
+        }
+        return compact;
+    }
+
+    /**
+     *  Synthetic daily candles from 2000-01-01, in period order.
+     */
+    inline std::vector<Candlestick> dailyCandles(int days) {
+        std::vector<Candlestick> candles;
+        candles.reserve(days);
+        const int32_t firstDay = DateTime{2000, 1, 1}.toEpochDays();
+        double previous = 10.0;
+        for (int day = 0; day < days; ++day) {
+            const double close = 10.0 + 12.0 * std::sin(day / 58.0) + 3.0 * std::sin(day * 1.7);
+            candles.emplace_back(DateTime::fromEpochDays(firstDay + day), previous, close, close + 4.0, close - 4.0);
+            previous = close;
+        }
+        return candles;
+    }
+}
+
+#define CHECK(condition)                                                              \
+    do {                                                                              \
+        if (!(condition)) {                                                           \
+            std::cout << __FILE__ << ":" << __LINE__ << ": CHECK failed: " #condition "\n"; \
+            ++TestSupport::failureCount();                                            \
+        }                                                                             \
+    } while (false)
+
+#endif
+//self written code end